@@ -35,6 +35,7 @@ list (APPEND MAIN_SOURCE_FILES
       opm/common/utility/DemangledType.cpp
       opm/common/utility/FileSystem.cpp
       opm/common/utility/MemPacker.cpp
+      opm/common/utility/SerializedImage.cpp
       opm/common/utility/OpmInputError.cpp
       opm/common/utility/shmatch.cpp
       opm/common/utility/String.cpp
@@ -243,6 +244,7 @@ if(ENABLE_ECL_INPUT)
     opm/input/eclipse/Schedule/SummaryState.cpp
     opm/input/eclipse/Schedule/Tuning.cpp
     opm/input/eclipse/Schedule/VFPInjTable.cpp
+    opm/input/eclipse/Schedule/VFPInterpolation.cpp
     opm/input/eclipse/Schedule/VFPProdTable.cpp
     opm/input/eclipse/Schedule/WriteRestartFileEvents.cpp
     opm/input/eclipse/Schedule/Action/ActionAST.cpp
@@ -477,6 +479,7 @@ list (APPEND TEST_SOURCE_FILES
       tests/test_nonuniformtablelinear.cpp
       tests/test_OpmInputError_format.cpp
       tests/test_OpmLog.cpp
+      tests/test_ParallelFor.cpp
       tests/test_param.cpp
       tests/test_RootFinders.cpp
       tests/test_ScheduleGrid.cpp
@@ -616,6 +619,7 @@ if(ENABLE_ECL_INPUT)
     tests/parser/UDQTests.cpp
     tests/parser/UDTTests.cpp
     tests/parser/UnitTests.cpp
+    tests/parser/VFPInterpolationTests.cpp
     tests/parser/integration/NNCTests.cpp
     tests/parser/WellSolventTests.cpp
     tests/parser/WellTracerTests.cpp
@@ -883,6 +887,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/common/utility/numeric/UniformTableLinear.hpp
       opm/common/utility/numeric/VectorOps.hpp
       opm/common/utility/OpmInputError.hpp
+      opm/common/utility/ParallelFor.hpp
       opm/common/utility/parameters/ParameterGroup.hpp
       opm/common/utility/parameters/ParameterGroup_impl.hpp
       opm/common/utility/parameters/Parameter.hpp
@@ -893,6 +898,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/common/utility/platform_dependent/disable_warnings.h
       opm/common/utility/platform_dependent/reenable_warnings.h
       opm/common/utility/shmatch.hpp
+      opm/common/utility/SerializedImage.hpp
       opm/common/utility/Serializer.hpp
       opm/common/utility/String.hpp
       opm/common/utility/TimeService.hpp
@@ -956,6 +962,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/binarycoefficients/H2O_CO2.hpp
       opm/material/binarycoefficients/Air_Xylene.hpp
       opm/material/binarycoefficients/Brine_CO2.hpp
+      opm/material/binarycoefficients/Brine_CO2SolubilityTable.hpp
       opm/material/binarycoefficients/Brine_H2.hpp
       opm/material/binarycoefficients/HenryIapws.hpp
       opm/material/Constants.hpp
@@ -1063,6 +1070,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/common/TridiagonalMatrix.hpp
       opm/material/common/ResetLocale.hpp
       opm/material/common/HasMemberGeneratorMacros.hpp
+      opm/material/common/SharedTableStorage.hpp
       opm/material/common/UniformTabulated2DFunction.hpp
       opm/material/common/FastSmallVector.hpp
       opm/material/common/ConditionalStorage.hpp
@@ -1373,6 +1381,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Schedule/ResCoup/ReadCouplingFile.hpp
        opm/input/eclipse/Schedule/ResCoup/WriteCouplingFile.hpp
        opm/input/eclipse/Schedule/VFPInjTable.hpp
+       opm/input/eclipse/Schedule/VFPInterpolation.hpp
        opm/input/eclipse/Schedule/VFPProdTable.hpp
        opm/input/eclipse/Schedule/Well/Connection.hpp
        opm/input/eclipse/Schedule/Well/FilterCake.hpp
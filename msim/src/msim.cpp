@@ -30,6 +30,8 @@
 #include <opm/input/eclipse/Python/Python.hpp>
 
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/FIPRegionStatistics.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
 #include <opm/input/eclipse/EclipseState/Runspec.hpp>
 
 #include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
@@ -68,6 +70,29 @@ namespace {
             }
         };
     }
+
+    // Pore volume of each region in each of the model's FIP region sets.
+    Opm::Inplace fipPoreVolumes(const Opm::EclipseState& es)
+    {
+        auto inplace = Opm::Inplace{};
+
+        const auto& fp = es.fieldProps();
+        const auto& fipStats = es.fipRegionStatistics();
+        const auto& porv = fp.porv(false);
+
+        for (const auto& regSet : fipStats.regionSets()) {
+            const auto maxRegionID = fipStats.maximumRegionID(regSet);
+            if (maxRegionID <= 0) {
+                continue;
+            }
+
+            const auto region = "FIP" + regSet;
+            inplace.add(region, Opm::Inplace::Phase::PoreVolume,
+                        Opm::Inplace::regionSums(fp.get_int(region), porv, maxRegionID));
+        }
+
+        return inplace;
+    }
 } // Anonymous namespace
 
 namespace Opm {
@@ -177,6 +202,8 @@ void msim::run_step(const WellTestState& wtest_state,
     const double start_time = this->schedule.seconds(report_step - 1);
     const double end_time = this->schedule.seconds(report_step);
 
+    const auto inplace = fipPoreVolumes(this->state);
+
     double seconds_elapsed = start_time;
     while (seconds_elapsed < end_time) {
         double time_step = dt;
@@ -196,7 +223,7 @@ void msim::run_step(const WellTestState& wtest_state,
                           group_nwrk_data,
                           /* sing_values = */ {},
                           /* initial_inplace = */ {},
-                          /* inplace = */ {});
+                          inplace);
 
         this->schedule.getUDQConfig(report_step - 1)
             .eval(report_step,
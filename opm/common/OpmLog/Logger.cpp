@@ -21,6 +21,7 @@
 #include <opm/common/OpmLog/Logger.hpp>
 
 #include <stdexcept>
+#include <utility>
 
 #include <opm/common/OpmLog/LogBackend.hpp>
 #include <opm/common/OpmLog/LogUtil.hpp>
@@ -45,13 +46,18 @@ namespace Opm {
             throw std::invalid_argument("Tried to issue message with unrecognized message ID");
 
         if (m_globalMask & messageType) {
-            for (auto iter : m_backends) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (const auto& iter : m_backends) {
                 LogBackend& backend = *(iter.second);
                 backend.addTaggedMessage( messageType, tag, message );
             }
         }
     }
 
+    bool Logger::isActive(int64_t messageType) const {
+        return (m_globalMask & messageType) != 0;
+    }
+
     void Logger::addMessage(int64_t messageType , const std::string& message) const {
         addTaggedMessage(messageType, "", message);
     }
@@ -63,6 +69,7 @@ namespace Opm {
 
 
     bool Logger::hasBackend(const std::string& name) {
+        std::lock_guard<std::mutex> lock(m_mutex);
         if (m_backends.find( name ) == m_backends.end())
             return false;
         else
@@ -70,11 +77,13 @@ namespace Opm {
     }
 
     void Logger::removeAllBackends() {
+        std::lock_guard<std::mutex> lock(m_mutex);
         m_backends.clear();
         m_globalMask = 0;
     }
 
     bool Logger::removeBackend(const std::string& name) {
+        std::lock_guard<std::mutex> lock(m_mutex);
         size_t eraseCount = m_backends.erase( name );
         if (eraseCount == 1)
             return true;
@@ -84,8 +93,9 @@ namespace Opm {
 
 
     void Logger::addBackend(const std::string& name , std::shared_ptr<LogBackend> backend) {
+        std::lock_guard<std::mutex> lock(m_mutex);
         updateGlobalMask( backend->getMask() );
-        m_backends[ name ] = backend;
+        m_backends[ name ] = std::move(backend);
     }
 
 
@@ -21,15 +21,21 @@
 #define OPM_LOGGER_HPP
 
 #include <stdexcept>
+#include <atomic>
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 
 namespace Opm {
 
     class LogBackend;
 
+/*
+  Messages may be added from several threads; they are passed to the
+  backends one at a time.
+*/
 class Logger {
 
 public:
@@ -37,6 +43,10 @@ public:
     void addMessage(int64_t messageType , const std::string& message) const;
     void addTaggedMessage(int64_t messageType, const std::string& tag, const std::string& message) const;
 
+    /// Whether any backend accepts messages of this type, i.e. whether it
+    /// is worth formatting such a message at all.
+    bool isActive(int64_t messageType) const;
+
     static bool enabledDefaultMessageType( int64_t messageType);
     bool enabledMessageType( int64_t messageType) const;
     void addMessageType( int64_t messageType , const std::string& prefix);
@@ -49,6 +59,7 @@ public:
 
     template <class BackendType>
     std::shared_ptr<BackendType> getBackend(const std::string& name) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
         auto pair = m_backends.find( name );
         if (pair == m_backends.end())
             throw std::invalid_argument("Invalid backend name: " + name);
@@ -58,12 +69,13 @@ public:
 
     template <class BackendType>
     std::shared_ptr<BackendType> popBackend(const std::string& name)  {
+        std::lock_guard<std::mutex> lock(m_mutex);
         auto pair = m_backends.find( name );
         if (pair == m_backends.end())
             throw std::invalid_argument("Invalid backend name: " + name);
         else {
             std::shared_ptr<LogBackend> backend = (*pair).second;
-            removeBackend( name );
+            m_backends.erase( pair );
             return std::static_pointer_cast<BackendType>(backend);
         }
     }
@@ -73,9 +85,10 @@ private:
     void updateGlobalMask( int64_t mask );
     static bool enabledMessageType( int64_t enabledTypes , int64_t messageType);
 
-    int64_t m_globalMask;
+    std::atomic<int64_t> m_globalMask;
     int64_t m_enabledTypes;
     std::map<std::string , std::shared_ptr<LogBackend> > m_backends;
+    mutable std::mutex m_mutex;
 };
 
 }
@@ -38,6 +38,10 @@
 #include <unistd.h> // For isatty()
 #endif
 
+namespace {
+    thread_local std::vector<Opm::OpmLog::CapturedMessage>* capture_buffer = nullptr;
+}
+
 namespace Opm {
 
     bool OpmLog::stdoutIsTerminal()
@@ -73,17 +77,46 @@ namespace Opm {
 
 
     void OpmLog::addMessage(int64_t messageFlag , const std::string& message) {
+        if (capture_buffer) {
+            capture_buffer->push_back({messageFlag, "", message});
+            return;
+        }
+
         if (m_logger)
             m_logger->addMessage( messageFlag , message );
     }
 
 
     void OpmLog::addTaggedMessage(int64_t messageFlag, const std::string& tag, const std::string& message) {
+        if (capture_buffer) {
+            capture_buffer->push_back({messageFlag, tag, message});
+            return;
+        }
+
         if (m_logger)
             m_logger->addTaggedMessage( messageFlag, tag, message );
     }
 
 
+    OpmLog::CaptureScope::CaptureScope(std::vector<CapturedMessage>& buffer)
+        : m_previous(capture_buffer)
+    {
+        capture_buffer = &buffer;
+    }
+
+
+    OpmLog::CaptureScope::~CaptureScope()
+    {
+        capture_buffer = m_previous;
+    }
+
+
+    void OpmLog::replay(const std::vector<CapturedMessage>& messages) {
+        for (const auto& message : messages)
+            addTaggedMessage(message.flag, message.tag, message.text);
+    }
+
+
     void OpmLog::info(const std::string& message)
     {
         addMessage(Log::MessageType::Info, message);
@@ -179,6 +212,13 @@ namespace Opm {
             return Logger::enabledDefaultMessageType( messageType );
     }
 
+    bool OpmLog::isActive( int64_t messageType ) {
+        if (capture_buffer)
+            return true;
+
+        return m_logger && m_logger->isActive( messageType );
+    }
+
     bool OpmLog::hasBackend(const std::string& name) {
         if (m_logger)
             return m_logger->hasBackend( name );
@@ -22,6 +22,8 @@
 
 #include <memory>
 #include <cstdint>
+#include <string>
+#include <vector>
 
 #include <opm/common/OpmLog/Logger.hpp>
 #include <opm/common/OpmLog/LogUtil.hpp>
@@ -66,6 +68,10 @@ public:
     static bool removeBackend(const std::string& name);
     static void removeAllBackends();
     static bool enabledMessageType( int64_t messageType );
+
+    /// Whether a message of this type would currently be emitted or
+    /// captured.  Lets callers skip formatting messages nobody will see.
+    static bool isActive( int64_t messageType );
     static void addMessageType( int64_t messageType , const std::string& prefix);
 
     /// Create a basic logging setup that will send all log messages to standard output.
@@ -109,6 +115,34 @@ public:
      */
     static bool setLogger(std::shared_ptr<Logger> logger);
 
+    struct CapturedMessage {
+        int64_t flag;
+        std::string tag;
+        std::string text;
+    };
+
+    /*
+      While a CaptureScope is alive, messages issued from the thread which
+      created it are appended to the buffer instead of being sent to the
+      backends. The buffer can then be passed to replay(), e.g. from
+      another thread, to emit the messages. This makes it possible to do
+      work on helper threads while keeping the log output in the same
+      order as a sequential run.
+    */
+    class CaptureScope {
+    public:
+        explicit CaptureScope(std::vector<CapturedMessage>& buffer);
+        ~CaptureScope();
+
+        CaptureScope(const CaptureScope&) = delete;
+        CaptureScope& operator=(const CaptureScope&) = delete;
+
+    private:
+        std::vector<CapturedMessage>* m_previous;
+    };
+
+    static void replay(const std::vector<CapturedMessage>& messages);
+
 private:
 #ifdef EMBEDDED_PYTHON
     friend class PyRunModule;
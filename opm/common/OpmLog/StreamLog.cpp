@@ -18,6 +18,7 @@
 */
 #include <stdexcept>
 #include <opm/common/OpmLog/StreamLog.hpp>
+#include <opm/common/OpmLog/LogUtil.hpp>
 
 namespace Opm {
 
@@ -44,7 +45,21 @@ StreamLog::StreamLog(std::ostream& os , int64_t messageMask) : LogBackend(messag
 }
 
 
+void StreamLog::flush() {
+    if (m_ostream) {
+        m_ostream->flush();
+    }
+    m_pendingLines = 0;
+    m_lastFlush = std::chrono::steady_clock::now();
+}
+
+
 void StreamLog::close() {
+    // Only touch the stream if there is something left to write, a
+    // borrowed stream may already be gone.
+    if (m_pendingLines > 0) {
+        flush();
+    }
     if (m_streamOwner && m_ofstream.is_open()) {
         m_ofstream.close();
         m_ostream = nullptr;
@@ -53,9 +68,17 @@ void StreamLog::close() {
 
 void StreamLog::addMessageUnconditionally(int64_t messageType, const std::string& message)
 {
-    (*m_ostream) << formatMessage(messageType, message) << std::endl;
-    if (m_ofstream.is_open()) {
-        m_ofstream.flush();
+    (*m_ostream) << formatMessage(messageType, message) << '\n';
+
+    // Informational messages are left in the stream buffer and written
+    // in batches; anything more severe is flushed at once, so it is not
+    // lost if the process dies.
+    constexpr auto batched = Log::MessageType::Debug | Log::MessageType::Info | Log::MessageType::Note;
+    if ((messageType & batched) == 0 ||
+        ++m_pendingLines >= flushLines ||
+        std::chrono::steady_clock::now() - m_lastFlush >= flushInterval)
+    {
+        flush();
     }
 }
 
@@ -20,6 +20,8 @@
 #ifndef STREAMLOG_H
 #define STREAMLOG_H
 
+#include <chrono>
+#include <cstddef>
 #include <fstream>
 #include <cstdint>
 
@@ -34,6 +36,15 @@ public:
     StreamLog(std::ostream& os , int64_t messageMask);
     ~StreamLog() override;
 
+    /// Write any batched messages to the stream.
+    void flush();
+
+    /// Debug, Info and Note messages are batched in the stream buffer, and
+    /// written out after this many lines, or when this much time has passed
+    /// since the last flush.  Other message types are flushed immediately.
+    static constexpr std::size_t flushLines = 100;
+    static constexpr std::chrono::seconds flushInterval{1};
+
 protected:
     void addMessageUnconditionally(int64_t messageType, const std::string& message) override;
 
@@ -43,6 +54,8 @@ private:
     std::ofstream   m_ofstream;
     std::ostream  * m_ostream;
     bool m_streamOwner;
+    std::size_t m_pendingLines = 0;
+    std::chrono::steady_clock::time_point m_lastFlush = std::chrono::steady_clock::now();
 };
 }
 
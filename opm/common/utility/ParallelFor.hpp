@@ -0,0 +1,63 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_PARALLEL_FOR_HPP
+#define OPM_PARALLEL_FOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+
+namespace Opm {
+
+//! \brief Call body(i) for i = 0, ..., n-1 in an OpenMP loop.
+//! \details Iterations are distributed dynamically over the threads, so
+//!          the body must only write to state owned by its own index.
+//!          Exceptions may not leave an OpenMP region.  They are therefore
+//!          caught in the loop, and the exception from the lowest index is
+//!          rethrown once all iterations have run.  This is the exception
+//!          a sequential loop would have thrown, although iterations past
+//!          that index have been executed too.
+template <class Body>
+void parallelFor(const std::size_t n, Body&& body)
+{
+    auto error = std::exception_ptr{};
+    auto errorIndex = std::numeric_limits<std::int64_t>::max();
+
+    #pragma omp parallel for schedule(dynamic)
+    for (std::int64_t i = 0; i < static_cast<std::int64_t>(n); ++i) {
+        try {
+            body(static_cast<std::size_t>(i));
+        }
+        catch (...) {
+            #pragma omp critical(opm_parallel_for_error)
+            if (i < errorIndex) {
+                errorIndex = i;
+                error = std::current_exception();
+            }
+        }
+    }
+
+    if (error != nullptr) {
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace Opm
+
+#endif // OPM_PARALLEL_FOR_HPP
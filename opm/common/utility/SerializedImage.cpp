@@ -0,0 +1,312 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+#include <opm/common/utility/SerializedImage.hpp>
+
+#include <project-version.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace {
+
+constexpr std::array<char, 8> magic { 'O', 'P', 'M', 'I', 'M', 'A', 'G', 'E' };
+
+// FNV-1a
+class Hash
+{
+public:
+    void add(const char* data, const std::size_t size)
+    {
+        std::for_each(data, data + size, [this](const char c)
+        {
+            this->value_ = (this->value_ ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+        });
+    }
+
+    std::uint64_t value() const
+    {
+        return this->value_;
+    }
+
+private:
+    std::uint64_t value_ = 14695981039346656037ULL;
+};
+
+// Leading part of an image file.  The payload follows the header.
+struct Header
+{
+    std::uint32_t version{0};
+    std::uint32_t sizeOfSizeT{0};
+    std::uint64_t layoutHash{0};
+    std::vector<Opm::SerializedImage::InputFile> inputFiles{};
+    std::uint64_t payloadSize{0};
+    std::uint64_t payloadHash{0};
+};
+
+// The header is packed item by item, rather than through a Serializer, so
+// that reading it can check each item against the size of the header.
+
+std::vector<char> packHeader(const Header& header)
+{
+    const Opm::Serialization::MemPacker packer{};
+
+    std::vector<char> buffer;
+    std::size_t position = 0;
+
+    const auto pack = [&buffer, &position, &packer](const auto& value)
+    {
+        buffer.resize(position + packer.packSize(value));
+        packer.pack(value, buffer, position);
+    };
+
+    pack(header.version);
+    pack(header.sizeOfSizeT);
+    pack(header.layoutHash);
+    pack(header.inputFiles.size());
+    for (const auto& file : header.inputFiles) {
+        pack(file.path);
+        pack(file.size);
+        pack(file.hash);
+    }
+    pack(header.payloadSize);
+    pack(header.payloadHash);
+
+    return buffer;
+}
+
+bool unpackHeader(const std::vector<char>& buffer, Header& header)
+{
+    const Opm::Serialization::MemPacker packer{};
+    std::size_t position = 0;
+
+    // A damaged header is rejected rather than read out of bounds.
+    const auto unpack = [&buffer, &position, &packer](auto& value)
+    {
+        if (position + sizeof(value) > buffer.size()) {
+            return false;
+        }
+        packer.unpack(value, buffer, position);
+        return true;
+    };
+
+    const auto unpackString = [&buffer, &position, &packer](std::string& value)
+    {
+        std::size_t size = 0;
+        if (position + sizeof(size) > buffer.size()) {
+            return false;
+        }
+        std::memcpy(&size, buffer.data() + position, sizeof(size));
+        if (size > buffer.size() - position - sizeof(size)) {
+            return false;
+        }
+        packer.unpack(value, buffer, position);
+        return true;
+    };
+
+    std::size_t numFiles = 0;
+    if (!unpack(header.version) || !unpack(header.sizeOfSizeT) ||
+        (header.version != Opm::SerializedImage::FormatVersion) ||
+        (header.sizeOfSizeT != sizeof(std::size_t)) ||
+        !unpack(header.layoutHash) || !unpack(numFiles) || (numFiles > buffer.size()))
+    {
+        return false;
+    }
+
+    header.inputFiles.resize(numFiles);
+    for (auto& file : header.inputFiles) {
+        if (!unpackString(file.path) || !unpack(file.size) || !unpack(file.hash)) {
+            return false;
+        }
+    }
+
+    return unpack(header.payloadSize)
+        && unpack(header.payloadHash)
+        && (position == buffer.size());
+}
+
+// Hash of the library version and the packed bytes of sample objects.
+// Images written by a build with a different serialization layout have a
+// different hash.
+std::uint64_t layoutHash(const std::vector<char>& layout)
+{
+    const auto version = std::string { PROJECT_VERSION };
+
+    auto hash = Hash{};
+    hash.add(version.data(), version.size());
+    hash.add(layout.data(), layout.size());
+
+    return hash.value();
+}
+
+bool isUnchanged(const Opm::SerializedImage::InputFile& file)
+{
+    std::error_code ec;
+    const auto size = std::filesystem::file_size(file.path, ec);
+    if (ec || (size != file.size)) {
+        return false;
+    }
+
+    try {
+        return Opm::SerializedImage::fingerprint(file.path) == file;
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+}
+
+} // Anonymous namespace
+
+namespace Opm {
+
+bool SerializedImage::InputFile::operator==(const InputFile& that) const
+{
+    return (this->path == that.path)
+        && (this->size == that.size)
+        && (this->hash == that.hash);
+}
+
+SerializedImage::InputFile
+SerializedImage::fingerprint(const std::string& path)
+{
+    std::ifstream is(path, std::ios::binary);
+    if (!is) {
+        throw std::invalid_argument("Unable to open input file " + path);
+    }
+
+    auto file = InputFile { path, 0, 0 };
+    auto hash = Hash{};
+
+    std::vector<char> chunk(std::size_t{1} << 20);
+    while (is) {
+        is.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+        const auto count = static_cast<std::size_t>(is.gcount());
+
+        hash.add(chunk.data(), count);
+        file.size += count;
+    }
+
+    file.hash = hash.value();
+    return file;
+}
+
+void SerializedImage::writeImage(const std::string& filename,
+                                 const std::vector<std::string>& inputFiles,
+                                 const std::vector<char>& layout,
+                                 const std::vector<char>& payload)
+{
+    auto header = Header{};
+    header.version = FormatVersion;
+    header.sizeOfSizeT = sizeof(std::size_t);
+    header.layoutHash = layoutHash(layout);
+    header.payloadSize = payload.size();
+
+    for (const auto& path : inputFiles) {
+        header.inputFiles.push_back(fingerprint(path));
+    }
+
+    {
+        auto hash = Hash{};
+        hash.add(payload.data(), payload.size());
+        header.payloadHash = hash.value();
+    }
+
+    const auto headerBuffer = packHeader(header);
+    const std::uint64_t headerSize = headerBuffer.size();
+
+    // Written to a temporary file first, so readers never see a partially
+    // written image.
+    const auto tmpFile = filename + ".tmp";
+    {
+        std::ofstream os(tmpFile, std::ios::binary | std::ios::trunc);
+        os.write(magic.data(), magic.size());
+        os.write(reinterpret_cast<const char*>(&headerSize), sizeof(headerSize));
+        os.write(headerBuffer.data(), static_cast<std::streamsize>(headerBuffer.size()));
+        os.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+
+        if (!os) {
+            throw std::runtime_error("Unable to write serialized image " + tmpFile);
+        }
+    }
+
+    std::filesystem::rename(tmpFile, filename);
+}
+
+std::optional<std::vector<char>>
+SerializedImage::readImage(const std::string& filename,
+                           const std::vector<char>& layout)
+{
+    std::ifstream is(filename, std::ios::binary);
+    if (!is) {
+        return std::nullopt;
+    }
+
+    std::error_code ec;
+    const auto fileSize = std::filesystem::file_size(filename, ec);
+    if (ec) {
+        return std::nullopt;
+    }
+
+    auto fileMagic = decltype(magic){};
+    std::uint64_t headerSize = 0;
+    is.read(fileMagic.data(), fileMagic.size());
+    is.read(reinterpret_cast<char*>(&headerSize), sizeof(headerSize));
+    if (!is || (fileMagic != magic) ||
+        (headerSize > fileSize - magic.size() - sizeof(headerSize)))
+    {
+        return std::nullopt;
+    }
+
+    std::vector<char> headerBuffer(headerSize);
+    is.read(headerBuffer.data(), static_cast<std::streamsize>(headerSize));
+
+    auto header = Header{};
+    if (!is || !unpackHeader(headerBuffer, header) ||
+        (header.layoutHash != layoutHash(layout)) ||
+        (header.payloadSize != fileSize - magic.size() - sizeof(headerSize) - headerSize))
+    {
+        return std::nullopt;
+    }
+
+    if (!std::all_of(header.inputFiles.begin(), header.inputFiles.end(), isUnchanged)) {
+        return std::nullopt;
+    }
+
+    std::vector<char> payload(header.payloadSize);
+    is.read(payload.data(), static_cast<std::streamsize>(payload.size()));
+    if (!is) {
+        return std::nullopt;
+    }
+
+    auto hash = Hash{};
+    hash.add(payload.data(), payload.size());
+    if (hash.value() != header.payloadHash) {
+        return std::nullopt;
+    }
+
+    return payload;
+}
+
+} // namespace Opm
@@ -0,0 +1,202 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_SERIALIZED_IMAGE_HPP
+#define OPM_SERIALIZED_IMAGE_HPP
+
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+/*! \brief On-disk image of serializable objects.
+ *! \details An image holds objects packed with a Serializer, e.g., a
+ *           Schedule and a SummaryConfig, together with the size and
+ *           content hash of the input files they were built from.
+ *           Reading an image fails, and leaves the objects untouched, if
+ *           the image has a different format version, is incomplete, or
+ *           if any of the input files has changed since the image was
+ *           written.
+ *
+ *           The packed layout follows the serializeOp() functions of the
+ *           objects, so an image must be read by the same build of the
+ *           library that wrote it.  The header records a hash of the
+ *           library version and of the packed bytes of sample objects of
+ *           each type, and images written by other builds are rejected.
+ */
+class SerializedImage
+{
+public:
+    //! \brief Size and content hash of an input file.
+    struct InputFile
+    {
+        std::string path{};
+        std::uint64_t size{0};
+        std::uint64_t hash{0};
+
+        bool operator==(const InputFile& that) const;
+    };
+
+    //! \brief Image format version.  Images of other versions are not read.
+    static constexpr std::uint32_t FormatVersion = 3;
+
+    //! \brief Size and content hash of an existing file.
+    static InputFile fingerprint(const std::string& path);
+
+    //! \brief Write objects to an image file.
+    //! \param filename Name of image file
+    //! \param inputFiles Files the objects are built from, e.g., the files of a deck.
+    //! \param data Objects to write
+    template<class... Args>
+    static void write(const std::string& filename,
+                      const std::vector<std::string>& inputFiles,
+                      const Args&... data)
+    {
+        ImageSerializer serializer;
+        serializer.pack(data...);
+
+        writeImage(filename, inputFiles, layout<Args...>(), serializer.buffer());
+    }
+
+    //! \brief Read objects from an image file.
+    //! \param filename Name of image file
+    //! \param data Objects to read, in the order they were written
+    //! \return Whether the image was valid and the objects were read.
+    template<class... Args>
+    static bool read(const std::string& filename, Args&... data)
+    {
+        auto payload = readImage(filename, layout<Args...>());
+        if (!payload.has_value()) {
+            return false;
+        }
+
+        // Unpacked into temporaries, so that the objects are only
+        // replaced once the whole payload has been read.
+        auto values = std::tuple<Args...>{};
+        try {
+            const auto payloadSize = payload->size();
+
+            ImageSerializer serializer;
+            serializer.setBuffer(std::move(*payload));
+            std::apply([&serializer](auto&... value) { serializer.unpack(value...); }, values);
+
+            if (serializer.position() != payloadSize) {
+                return false;
+            }
+        }
+        catch (const std::exception&) {
+            return false;
+        }
+
+        std::tie(data...) = std::move(values);
+
+        return true;
+    }
+
+private:
+    //! \brief Detect existence of static \c serializationTestObject function.
+    template<class T, class = void>
+    struct has_serializationTestObject : std::false_type {};
+
+    template<class T>
+    struct has_serializationTestObject<
+        T, std::void_t<decltype(T::serializationTestObject())>
+    > : std::true_type {};
+
+    //! \brief Sample object of a type.
+    //! \details The serialization test object where available, since its
+    //!          members are populated, and a default constructed object
+    //!          otherwise.
+    template<class T>
+    static T sample()
+    {
+        if constexpr (has_serializationTestObject<T>::value) {
+            return T::serializationTestObject();
+        }
+        else {
+            return T{};
+        }
+    }
+
+    //! \brief Packed sample objects of each type, each preceded by its size.
+    //! \details The bytes change with most changes to the serializeOp()
+    //!          functions of the types, including reordered members or
+    //!          members of another type of the same size.
+    template<class... Args>
+    static std::vector<char> layout()
+    {
+        ImageSerializer serializer;
+        auto bytes = std::vector<char>{};
+        const auto append = [&serializer, &bytes](const auto& object)
+        {
+            serializer.pack(object);
+            const auto& buffer = serializer.buffer();
+            const std::uint64_t size = buffer.size();
+            const auto* sizeBytes = reinterpret_cast<const char*>(&size);
+            bytes.insert(bytes.end(), sizeBytes, sizeBytes + sizeof(size));
+            bytes.insert(bytes.end(), buffer.begin(), buffer.end());
+        };
+        (append(sample<Args>()), ...);
+
+        return bytes;
+    }
+
+    //! \brief Serializer with access to its buffer.
+    class ImageSerializer : public Serializer<Serialization::MemPacker>
+    {
+    public:
+        ImageSerializer()
+            : Serializer<Serialization::MemPacker>(packer_)
+        {}
+
+        const std::vector<char>& buffer() const
+        {
+            return m_buffer;
+        }
+
+        void setBuffer(std::vector<char>&& buffer)
+        {
+            m_buffer = std::move(buffer);
+        }
+
+    private:
+        static inline const Serialization::MemPacker packer_{};
+    };
+
+    static void writeImage(const std::string& filename,
+                           const std::vector<std::string>& inputFiles,
+                           const std::vector<char>& layout,
+                           const std::vector<char>& payload);
+
+    static std::optional<std::vector<char>>
+    readImage(const std::string& filename,
+              const std::vector<char>& layout);
+};
+
+} // namespace Opm
+
+#endif // OPM_SERIALIZED_IMAGE_HPP
@@ -128,29 +128,26 @@ public:
         } else {
             if (m_op == Operation::PACKSIZE)
                 m_packSize += m_packer.packSize(data);
-            else if (m_op == Operation::PACK)
+            else if (m_op == Operation::PACK) {
+                growBuffer(m_packer.packSize(data));
                 m_packer.pack(data, m_buffer, m_position);
+            }
             else if (m_op == Operation::UNPACK)
                 m_packer.unpack(const_cast<T&>(data), m_buffer, m_position);
         }
     }
 
     //! \brief Call this to serialize data.
+    //! \details The object is traversed once.  Data is packed in chunks,
+    //!          which are joined into a buffer of the packed size.
     //! \tparam T Type of class to serialize
     //! \param data Class to serialize
     template<class T>
     void pack(const T& data)
     {
-        m_ptrmap.clear();
-        m_op = Operation::PACKSIZE;
-        m_packSize = 0;
-        (*this)(data);
-        m_position = 0;
-        m_buffer.resize(m_packSize);
-        m_ptrmap.clear();
-        m_op = Operation::PACK;
+        beginPack();
         (*this)(data);
-        m_ptrmap.clear();
+        endPack();
     }
 
     //! \brief Call this to serialize data.
@@ -159,16 +156,9 @@ public:
     template<class... Args>
     void pack(const Args&... data)
     {
-        m_ptrmap.clear();
-        m_op = Operation::PACKSIZE;
-        m_packSize = 0;
+        beginPack();
         variadic_call(data...);
-        m_position = 0;
-        m_buffer.resize(m_packSize);
-        m_ptrmap.clear();
-        m_op = Operation::PACK;
-        variadic_call(data...);
-        m_ptrmap.clear();
+        endPack();
     }
 
     //! \brief Call this to de-serialize data.
@@ -225,6 +215,7 @@ protected:
           } else if (m_op == Operation::PACK) {
               (*this)(data.size());
               if (data.size() > 0) {
+                  growBuffer(m_packer.packSize(data.data(), data.size()));
                   m_packer.pack(data.data(), data.size(), m_buffer, m_position);
               }
           } else if (m_op == Operation::UNPACK) {
@@ -284,8 +275,10 @@ protected:
         if constexpr (detail::is_pod_v<T>) {
             if (m_op == Operation::PACKSIZE)
                 m_packSize += m_packer.packSize(data.data(), data.size());
-            else if (m_op == Operation::PACK)
+            else if (m_op == Operation::PACK) {
+                growBuffer(m_packer.packSize(data.data(), data.size()));
                 m_packer.pack(data.data(), data.size(), m_buffer, m_position);
+            }
             else if (m_op == Operation::UNPACK) {
                 auto& data_mut = const_cast<Array&>(data);
                 m_packer.unpack(data_mut.data(), data_mut.size(), m_buffer, m_position);
@@ -554,20 +547,30 @@ protected:
     > : public std::true_type {};
 
     //! \brief Handler for shared pointers.
+    //! \details Pointees are packed as the order in which they are first
+    //!          met rather than as their address, so that equal objects
+    //!          pack to equal bytes.
     template<class PtrType>
     void shared_ptr(const PtrType& data)
     {
         using T1 = typename PtrType::element_type;
-        std::uintptr_t data_ptr = reinterpret_cast<std::uintptr_t>(data.get());
-        (*this)(data_ptr);
-        if (!data_ptr)
-            return;
         if (m_op == Operation::PACK || m_op == Operation::PACKSIZE) {
-            if (m_ptrmap.count(data_ptr) == 0) {
-                (*this)(*data);
-                m_ptrmap[data_ptr].reset();
+            std::uintptr_t data_id = 0;
+            bool first = false;
+            if (data) {
+                const auto address = reinterpret_cast<std::uintptr_t>(data.get());
+                const auto [pos, inserted] = m_ptrids.try_emplace(address, m_ptrids.size() + 1);
+                data_id = pos->second;
+                first = inserted;
             }
+            (*this)(data_id);
+            if (first)
+                (*this)(*data);
         } else {  // m_op == Operation::UNPACK
+            std::uintptr_t data_ptr = 0;
+            (*this)(data_ptr);
+            if (!data_ptr)
+                return;
             if (m_ptrmap.count(data_ptr) == 0) {
                 const_cast<PtrType&>(data) = std::make_shared<T1>();
                 m_ptrmap[data_ptr] = std::static_pointer_cast<void>(data);
@@ -598,12 +601,86 @@ protected:
         }
     }
 
+    //! \brief Prepare for a single pass packing operation.
+    void beginPack()
+    {
+        m_ptrids.clear();
+        m_op = Operation::PACK;
+        m_packSize = 0;
+        m_position = 0;
+        m_buffer = std::vector<char>{};
+        m_chunks.clear();
+        m_chunkedSize = 0;
+    }
+
+    //! \brief Finish a packing operation.
+    //! \details Joins the packed chunks into the buffer, whose size and
+    //!          capacity are then the packed size, which is also reported
+    //!          as the pack size.  While joining, at most about twice the
+    //!          packed size is allocated.
+    void endPack()
+    {
+        if (m_chunks.empty()) {
+            m_buffer.resize(m_position);
+            m_buffer.shrink_to_fit();
+        }
+        else {
+            auto buffer = std::vector<char>{};
+            buffer.reserve(m_chunkedSize + m_position);
+            for (auto& chunk : m_chunks) {
+                buffer.insert(buffer.end(), chunk.begin(), chunk.end());
+                chunk = std::vector<char>{};
+            }
+            buffer.insert(buffer.end(), m_buffer.begin(), m_buffer.begin() + m_position);
+
+            m_buffer = std::move(buffer);
+            m_chunks.clear();
+            m_chunkedSize = 0;
+        }
+
+        m_position = m_buffer.size();
+        m_packSize = m_position;
+        m_ptrids.clear();
+    }
+
+    //! \brief Make room for n more bytes at the current position.
+    //! \details Data is packed into a sequence of chunks, which endPack()
+    //!          joins.  Chunks are never reallocated.  They grow with the
+    //!          packed size up to maxChunkSize, and an item which does not
+    //!          fit gets a chunk of exactly its size.
+    void growBuffer(const std::size_t n)
+    {
+        if (m_position + n <= m_buffer.size()) {
+            return;
+        }
+
+        if (m_position > 0) {
+            m_buffer.resize(m_position);
+            if (2*m_position < m_buffer.capacity()) {
+                // Mostly unused, e.g., since a large item follows.
+                m_buffer.shrink_to_fit();
+            }
+            m_chunkedSize += m_position;
+            m_chunks.push_back(std::move(m_buffer));
+        }
+
+        const auto chunkSize = std::clamp(m_chunkedSize, minChunkSize, maxChunkSize);
+        m_buffer = std::vector<char>(std::max(n, chunkSize));
+        m_position = 0;
+    }
+
+    static constexpr std::size_t minChunkSize = 4096; //!< Size of first chunk when packing
+    static constexpr std::size_t maxChunkSize = std::size_t{1} << 20; //!< Largest chunk, unless for a single larger item
+
     const Packer& m_packer; //!< Packer to use
     Operation m_op = Operation::PACKSIZE; //!< Current operation
     size_t m_packSize = 0; //!< Required buffer size after PACKSIZE has been done
     size_t m_position = 0; //!< Current position in buffer
-    std::vector<char> m_buffer; //!< Buffer for serialized data
-    std::map<std::uintptr_t, std::shared_ptr<void>> m_ptrmap; //!< Map to keep track of which pointer data has been serialized and actual pointers during unpacking
+    std::vector<char> m_buffer; //!< Buffer for serialized data, the current chunk while packing
+    std::vector<std::vector<char>> m_chunks; //!< Full chunks while packing
+    std::size_t m_chunkedSize = 0; //!< Packed size of the full chunks
+    std::map<std::uintptr_t, std::shared_ptr<void>> m_ptrmap; //!< Map to keep track of actual pointers during unpacking
+    std::map<std::uintptr_t, std::uintptr_t> m_ptrids; //!< Packed ids of the pointees serialized so far, by address
 };
 
 }
@@ -21,6 +21,10 @@
 
 #include <opm/common/utility/shmatch.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+
 #if HAVE_FNMATCH_H
 #include <fnmatch.h>
 #else
@@ -55,3 +59,103 @@ bool Opm::shmatch(const std::string& pattern, const std::string& symbol)
 #endif
 }
 
+
+namespace {
+
+    // Whether 'piece', possibly containing '?' wildcards, matches 'symbol'
+    // at position 'pos'.
+    bool piece_match(const std::string& piece,
+                     std::string_view   symbol,
+                     const std::size_t  pos)
+    {
+        if (pos + piece.size() > symbol.size())
+            return false;
+
+        for (std::size_t i = 0; i < piece.size(); ++i) {
+            if ((piece[i] != '?') && (piece[i] != symbol[pos + i]))
+                return false;
+        }
+
+        return true;
+    }
+
+} // Anonymous namespace
+
+Opm::ShellPattern::ShellPattern(const std::string& pattern)
+    : m_pattern(pattern)
+{
+    // Bracket expressions and escapes are left to shmatch().
+    if (pattern.find_first_of("[\\") != std::string::npos) {
+        this->m_fallback = true;
+        return;
+    }
+
+    this->m_literal = pattern.find_first_of("*?") == std::string::npos;
+    this->m_leading_star = !pattern.empty() && (pattern.front() == '*');
+    this->m_trailing_star = !pattern.empty() && (pattern.back() == '*');
+
+    std::size_t start = 0;
+    while (start <= pattern.size()) {
+        const auto end = std::min(pattern.find('*', start), pattern.size());
+        if (end > start)
+            this->m_pieces.push_back(pattern.substr(start, end - start));
+
+        start = end + 1;
+    }
+}
+
+bool Opm::ShellPattern::match(const std::string& symbol) const
+{
+    if (this->m_fallback)
+        return shmatch(this->m_pattern, symbol);
+
+    if (this->m_literal)
+        return symbol == this->m_pattern;
+
+    const auto has_star = this->m_leading_star || this->m_trailing_star || (this->m_pieces.size() > 1);
+    if (!has_star) {
+        // Only '?' wildcards.
+        return (symbol.size() == this->m_pattern.size())
+            && piece_match(this->m_pattern, symbol, 0);
+    }
+
+    auto first = this->m_pieces.begin();
+    auto last = this->m_pieces.end();
+
+    std::size_t begin = 0;
+    std::size_t end = symbol.size();
+
+    if (!this->m_leading_star) {
+        if (!piece_match(*first, symbol, 0))
+            return false;
+
+        begin = first->size();
+        ++first;
+    }
+
+    if (!this->m_trailing_star && (first != last)) {
+        const auto& piece = *(last - 1);
+        if ((piece.size() > end - begin) || !piece_match(piece, symbol, end - piece.size()))
+            return false;
+
+        end -= piece.size();
+        --last;
+    }
+
+    // Remaining pieces are separated by '*' on both sides, and are matched
+    // at their leftmost position.
+    for (; first != last; ++first) {
+        const auto view = std::string_view { symbol }.substr(0, end);
+
+        auto pos = begin;
+        while ((pos + first->size() <= end) && !piece_match(*first, view, pos))
+            ++pos;
+
+        if (pos + first->size() > end)
+            return false;
+
+        begin = pos + first->size();
+    }
+
+    return true;
+}
@@ -21,6 +21,7 @@
 #define OPM_UTILITY_SHMATCH_HPP
 
 #include <string>
+#include <vector>
 
 namespace Opm {
 
@@ -32,6 +33,37 @@ namespace Opm {
 
 bool shmatch(const std::string& pattern, const std::string& symbol);
 
+/*
+  The ShellPattern class holds a shell pattern which has been compiled for
+  repeated matching, e.g., when a well or group name pattern is evaluated
+  against every name in a model. Patterns using only the '*' and '?'
+  wildcards are matched directly on the pieces between the '*' characters;
+  other patterns, e.g. with bracket expressions, fall back to shmatch().
+  Matching follows fnmatch() semantics, as shmatch() does where fnmatch() is
+  available.
+*/
+
+class ShellPattern
+{
+public:
+    explicit ShellPattern(const std::string& pattern);
+
+    bool match(const std::string& symbol) const;
+    bool operator()(const std::string& symbol) const { return this->match(symbol); }
+
+    // Whether the pattern contains no wildcards, i.e. matches one name only.
+    bool is_literal() const { return this->m_literal; }
+
+    const std::string& pattern() const { return this->m_pattern; }
+
+private:
+    std::string m_pattern;
+    std::vector<std::string> m_pieces;
+    bool m_leading_star{false};
+    bool m_trailing_star{false};
+    bool m_literal{false};
+    bool m_fallback{false};
+};
 
 }
 #endif //OPM_UTILITY_STRING_HPP
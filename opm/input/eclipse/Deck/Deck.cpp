@@ -76,7 +76,7 @@ const DeckView& Deck::global_view() const {
         , m_dataFile( d.m_dataFile )
         , input_path( d.input_path )
         , file_tree( d.file_tree )
-        , unit_system_access_count(d.unit_system_access_count)
+        , unit_system_access_count(d.unit_system_access_count.load())
     {
     }
 
@@ -87,7 +87,7 @@ const DeckView& Deck::global_view() const {
         , m_dataFile( d.m_dataFile )
         , input_path( d.input_path )
         , file_tree( std::move(d.file_tree) )
-        , unit_system_access_count(d.unit_system_access_count)
+        , unit_system_access_count(d.unit_system_access_count.load())
     {
     }
 
@@ -225,7 +225,7 @@ const DeckView& Deck::global_view() const {
         defaultUnits = data.defaultUnits;
         m_dataFile = data.m_dataFile;
         input_path = data.input_path;
-        unit_system_access_count = data.unit_system_access_count;
+        unit_system_access_count = data.unit_system_access_count.load();
         activeUnits = data.activeUnits;
 
         return *this;
@@ -242,7 +242,7 @@ const DeckView& Deck::global_view() const {
                this->defaultUnits == data.defaultUnits &&
                this->m_dataFile == data.m_dataFile &&
                this->input_path == data.input_path &&
-               this->unit_system_access_count == data.unit_system_access_count;
+               this->unit_system_access_count.load() == data.unit_system_access_count.load();
     }
 
     std::ostream& operator<<(std::ostream& os, const Deck& deck) {
@@ -25,6 +25,7 @@
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
+#include <atomic>
 #include <iosfwd>
 #include <memory>
 #include <optional>
@@ -104,7 +105,9 @@ namespace Opm {
                 serializer(activeUnits);
                 serializer(m_dataFile);
                 serializer(input_path);
-                serializer(unit_system_access_count);
+                auto access_count = this->unit_system_access_count.load();
+                serializer(access_count);
+                this->unit_system_access_count = access_count;
             }
 
             bool hasKeyword( const std::string& keyword ) const;
@@ -137,7 +140,9 @@ namespace Opm {
             std::optional<std::string> m_dataFile;
             std::string input_path;
             DeckTree file_tree;
-            mutable std::size_t unit_system_access_count = 0;
+            // Atomic, since the grid is built on a separate thread while
+            // other components read the deck.
+            mutable std::atomic<std::size_t> unit_system_access_count{0};
 
             const DeckView& global_view() const;
             mutable std::unique_ptr<DeckView> m_global_view{nullptr};
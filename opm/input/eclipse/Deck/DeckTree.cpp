@@ -18,7 +18,11 @@
 
 #include <opm/input/eclipse/Deck/DeckTree.hpp>
 
+#include <algorithm>
 #include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace fs = std::filesystem;
 
@@ -93,6 +97,22 @@ void DeckTree::add_include(std::string parent_file, std::string include_file) {
     parent_node.add_include( include_file );
 }
 
+std::vector<std::string> DeckTree::files() const {
+    if (!this->root_file.has_value())
+        return {};
+
+    std::vector<std::string> include_files;
+    for (const auto& [fname, node] : this->nodes) {
+        if (fname != *this->root_file)
+            include_files.push_back(fname);
+    }
+    std::sort(include_files.begin(), include_files.end());
+
+    std::vector<std::string> all_files { *this->root_file };
+    all_files.insert(all_files.end(), include_files.begin(), include_files.end());
+    return all_files;
+}
+
 bool DeckTree::has_include(const std::string& fname) const {
     const auto& node = this->nodes.at(fname);
     return !node.include_files.empty();
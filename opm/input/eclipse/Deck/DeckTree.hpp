@@ -24,6 +24,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <optional>
+#include <vector>
 
 
 namespace Opm {
@@ -47,6 +48,10 @@ public:
     bool has_include(const std::string& fname) const;
     const std::string& root() const;
 
+    // All files in the tree, root file first and the include files in
+    // sorted order.  Empty if no root file has been assigned.
+    std::vector<std::string> files() const;
+
 private:
     class TreeNode {
     public:
@@ -144,6 +144,37 @@ namespace Opm {
         else {
             activityModel = ParserKeywords::ACTCO2S::ACTIVITY_MODEL::defaultValue;
         }
+
+        // CO2SOLTB
+        if (props_section.hasKeyword<ParserKeywords::CO2SOLTB>()) {
+            using TB = ParserKeywords::CO2SOLTB;
+            const auto& keyword = props_section.get<TB>().back();
+            const auto& record = keyword.getRecord(0);
+
+            SolubilityTable table;
+            table.pressure_min = record.getItem<TB::PRESSURE_MIN>().getSIDouble(0);
+            table.pressure_max = record.getItem<TB::PRESSURE_MAX>().getSIDouble(0);
+            if (const auto& item = record.getItem<TB::TEMPERATURE_MIN>(); !item.defaultApplied(0)) {
+                table.temperature_min = item.getSIDouble(0);
+            }
+            if (const auto& item = record.getItem<TB::TEMPERATURE_MAX>(); !item.defaultApplied(0)) {
+                table.temperature_max = item.getSIDouble(0);
+            }
+            table.tolerance = record.getItem<TB::TOLERANCE>().get<double>(0);
+
+            if (!(table.pressure_min < table.pressure_max)) {
+                throw OpmInputError("CO2SOLTB requires PRESSURE_MIN < PRESSURE_MAX", keyword.location());
+            }
+            if (table.temperature_min && table.temperature_max
+                && !(*table.temperature_min <= *table.temperature_max))
+            {
+                throw OpmInputError("CO2SOLTB requires TEMPERATURE_MIN <= TEMPERATURE_MAX", keyword.location());
+            }
+            if (!(table.tolerance > 0.0)) {
+                throw OpmInputError("CO2SOLTB requires a positive TOLERANCE", keyword.location());
+            }
+            solubility_table = table;
+        }
     }
 
     const std::vector<EzrokhiTable>& Co2StoreConfig::getDenaqaTables() const {
@@ -162,6 +193,18 @@ namespace Opm {
         return activityModel;
     }
 
+    const std::optional<Co2StoreConfig::SolubilityTable>& Co2StoreConfig::solubilityTable() const {
+        return solubility_table;
+    }
+
+    bool Co2StoreConfig::SolubilityTable::operator==(const SolubilityTable& other) const {
+        return this->pressure_min == other.pressure_min
+                && this->pressure_max == other.pressure_max
+                && this->temperature_min == other.temperature_min
+                && this->temperature_max == other.temperature_max
+                && this->tolerance == other.tolerance;
+    }
+
     bool Co2StoreConfig::operator==(const Co2StoreConfig& other) const {
         return this->brine_type == other.brine_type 
                 && this->liquid_type == other.liquid_type
@@ -170,6 +213,7 @@ namespace Opm {
                 && this->viscaqa_tables == other.viscaqa_tables
                 && this->salt == other.salt
                 && this->activityModel == other.activityModel
+                && this->solubility_table == other.solubility_table
                 && this->cnames == other.cnames;
     }
 
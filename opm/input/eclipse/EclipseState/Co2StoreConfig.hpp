@@ -20,6 +20,7 @@
 #define	OPM_PARSER_CO2STORECONFIG_HPP
 
 #include <cstddef>
+#include <optional>
 #include <vector>
 #include <string>
 #include <map>
@@ -49,6 +50,29 @@ class Deck;
         IDEAL,  // Ideal mixing
     };
 
+    //! Range and tolerance of the tabulated CO2-brine solubility (CO2SOLTB).
+    //! A defaulted temperature bound means the reservoir temperature.
+    struct SolubilityTable
+    {
+        double pressure_min {0.0};
+        double pressure_max {0.0};
+        std::optional<double> temperature_min {};
+        std::optional<double> temperature_max {};
+        double tolerance {1e-5};
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(pressure_min);
+            serializer(pressure_max);
+            serializer(temperature_min);
+            serializer(temperature_max);
+            serializer(tolerance);
+        }
+
+        bool operator==(const SolubilityTable& other) const;
+    };
+
     Co2StoreConfig();
 
     explicit Co2StoreConfig(const Deck& deck);
@@ -58,6 +82,7 @@ class Deck;
     
     double salinity() const;
     int actco2s() const;
+    const std::optional<SolubilityTable>& solubilityTable() const;
 
     template<class Serializer>
     void serializeOp(Serializer& serializer)
@@ -70,6 +95,7 @@ class Deck;
        serializer(viscaqa_tables);
        serializer(salt);
        serializer(activityModel);
+       serializer(solubility_table);
     }
     bool operator==(const Co2StoreConfig& other) const;
 
@@ -90,6 +116,7 @@ class Deck;
     static constexpr double MmNaCl = 58.44e-3;
     static constexpr double MmH2O = 18e-3;
     int activityModel {3};
+    std::optional<SolubilityTable> solubility_table;
   };
 }
 
@@ -56,11 +56,16 @@
 #include <fmt/format.h>
 #include <fmt/ranges.h>
 
+#include <chrono>
 #include <cstddef>
 #include <filesystem>
+#include <functional>
+#include <future>
 #include <map>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <system_error>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -129,45 +134,176 @@ namespace Opm {
 // process is done twice, first after the initial field_props processing and
 // subsequently after the processing of numerical aquifers.
 
+    // Helper for the constructor which builds the input grid and its NNCs
+    // on a separate thread while the deck-only components (tables, runspec
+    // and configuration) are set up on the calling thread, and records the
+    // time spent in each phase.  Log messages from the grid thread are held
+    // back and emitted at the point where a sequential construction would
+    // have issued them, so the log output does not depend on the threading.
+    class EclipseState::Initializer
+    {
+    public:
+        struct Grid
+        {
+            EclipseGrid grid{};
+            NNC nnc{};
+        };
+
+        // Both threads read the deck without copying it.  This is safe
+        // since the keyword index is created here, before the grid thread
+        // starts, the deck's unit system access count is atomic, and the
+        // grid thread is the only reader of the floating point items of the
+        // GRID and EDIT sections until it is joined.  Those items convert
+        // their data to SI units in place on first access.  The calling
+        // thread only reads RUNSPEC, PROPS and later sections and integer
+        // switches such as GRIDFILE meanwhile.
+        explicit Initializer(const Deck& deck)
+            : m_start(Clock::now())
+        {
+            deck.hasKeyword("GRID");
+
+            try {
+                this->m_grid_future = std::async(std::launch::async, &Initializer::buildGrid, this, std::cref(deck));
+            }
+            catch (const std::system_error&) {
+                this->m_grid_future = std::async(std::launch::deferred, &Initializer::buildGrid, this, std::cref(deck));
+            }
+        }
+
+        template <class Function>
+        auto timed(const char* phase, Function&& function)
+        {
+            const PhaseTimer timer { this->m_timings, phase };
+            return function();
+        }
+
+        Grid& grid()
+        {
+            if (! this->m_grid.has_value()) {
+                try {
+                    this->m_grid.emplace(this->m_grid_future.get());
+                }
+                catch (...) {
+                    OpmLog::replay(this->m_grid_messages);
+                    throw;
+                }
+
+                OpmLog::replay(this->m_grid_messages);
+                this->m_timings.emplace_back("EclipseGrid", this->m_grid_time);
+            }
+
+            return *this->m_grid;
+        }
+
+        std::vector<std::pair<std::string, double>> finish()
+        {
+            this->m_timings.emplace_back("Total", seconds(this->m_start));
+            return std::move(this->m_timings);
+        }
+
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        static double seconds(const Clock::time_point start)
+        {
+            return std::chrono::duration<double>(Clock::now() - start).count();
+        }
+
+        struct PhaseTimer
+        {
+            std::vector<std::pair<std::string, double>>& timings;
+            const char* phase;
+            Clock::time_point start { Clock::now() };
+
+            ~PhaseTimer()
+            {
+                this->timings.emplace_back(this->phase, seconds(this->start));
+            }
+        };
+
+        Grid buildGrid(const Deck& deck)
+        {
+            const OpmLog::CaptureScope capture { this->m_grid_messages };
+            const auto start = Clock::now();
+
+            Grid grid { EclipseGrid(deck, nullptr), {} };
+            grid.nnc = NNC(grid.grid, deck);
+
+            this->m_grid_time = seconds(start);
+            return grid;
+        }
+
+        Clock::time_point m_start;
+        std::vector<std::pair<std::string, double>> m_timings{};
+        std::vector<OpmLog::CapturedMessage> m_grid_messages{};
+        double m_grid_time{0.0};
+        std::optional<Grid> m_grid{};
+
+        // Declared last, so that the grid thread is joined before the
+        // members it writes to are destroyed.
+        std::future<Grid> m_grid_future{};
+    };
+
     EclipseState::EclipseState(const Deck& deck)
+        : EclipseState(deck, Initializer{deck})
+    {}
+
+    EclipseState::EclipseState(const Deck& deck, Initializer&& init)
     try
-        : m_tables(            deck )
-        , m_runspec(           deck )
-        , m_eclipseConfig(     deck )
+        : m_tables(            init.timed("TableManager", [&deck] { return TableManager(deck); }) )
+        , m_runspec(           init.timed("Runspec", [&deck] { return Runspec(deck); }) )
+        , m_eclipseConfig(     init.timed("EclipseConfig", [&deck] { return EclipseConfig(deck); }) )
         , m_deckUnitSystem(    deck.getActiveUnitSystem() )
-        , m_inputGrid(         deck, nullptr )
-        , m_inputNnc(          m_inputGrid, deck)
+        , m_inputGrid(         std::move(init.grid().grid) )
+        , m_inputNnc(          std::move(init.grid().nnc) )
         , m_gridDims(          deck )
-        , field_props(         deck, m_runspec.phases(), m_inputGrid, m_tables, m_runspec.numComps())
+        , field_props(         init.timed("FieldPropsManager", [&deck, this] {
+                                   return FieldPropsManager(deck, m_runspec.phases(), m_inputGrid,
+                                                            m_tables, m_runspec.numComps());
+                               }) )
         , m_simulationConfig(  m_eclipseConfig.init().restartRequested(), deck, field_props)
-        , aquifer_config(      m_tables, m_inputGrid, deck, field_props)
+        , aquifer_config(      init.timed("AquiferConfig", [&deck, this] {
+                                   return AquiferConfig(m_tables, m_inputGrid, deck, field_props);
+                               }) )
         , compositional_config(deck, m_runspec)
-        , m_transMult(         GridDims(deck), deck, field_props)
+        , m_transMult(         init.timed("TransMult", [&deck, this] {
+                                   return TransMult(GridDims(deck), deck, field_props);
+                               }) )
         , tracer_config(       m_deckUnitSystem, deck)
         , wag_hyst_config(     deck)
         , co2_store_config(    deck)
     {
-        this->assignRunTitle(deck);
-        this->reportNumberOfActivePhases();
+        init.timed("Finalize", [&deck, this] {
+            this->assignRunTitle(deck);
+            this->reportNumberOfActivePhases();
 
-        if (field_props.has_double("MINPVV")) {
-            this->m_inputGrid.setMINPVV(field_props.get_global_double("MINPVV"));
-        }
-        this->conveyNumericalAquiferEffects();
-        if (field_props.has_double("MINPVV")) {
-            field_props.deleteMINPVV();
-        }
-        this->initLgrs(deck);
-        this->aquifer_config.load_connections(deck, this->getInputGrid());
+            if (field_props.has_double("MINPVV")) {
+                this->m_inputGrid.setMINPVV(field_props.get_global_double("MINPVV"));
+            }
+            this->conveyNumericalAquiferEffects();
+            if (field_props.has_double("MINPVV")) {
+                field_props.deleteMINPVV();
+            }
+            this->initLgrs(deck);
+            this->aquifer_config.load_connections(deck, this->getInputGrid());
+
+            this->applyMULTXYZ();
+            this->initFaults(deck);
+            m_simulationConfig.m_ThresholdPressure.readFaults(deck,m_faults);
+
+            if (this->getInitConfig().restartRequested()) {
+                verify_consistent_restart_information(deck.get<ParserKeywords::RESTART>().back(),
+                                                      this->getIOConfig(), this->getInitConfig());
+            }
+        });
 
-        this->applyMULTXYZ();
-        this->initFaults(deck);
-        m_simulationConfig.m_ThresholdPressure.readFaults(deck,m_faults);
+        this->m_init_timings = init.finish();
 
-        if (this->getInitConfig().restartRequested()) {
-            verify_consistent_restart_information(deck.get<ParserKeywords::RESTART>().back(),
-                                                  this->getIOConfig(), this->getInitConfig());
+        std::string report = "EclipseState initialization timing (seconds):";
+        for (const auto& [phase, time] : this->m_init_timings) {
+            report += fmt::format("\n  {:<20} {:8.3f}", phase, time);
         }
+        OpmLog::debug(report);
     }
     catch (const OpmInputError& opm_error) {
         OpmLog::error(opm_error.what());
@@ -42,6 +42,8 @@
 #include <cstddef>
 #include <memory>
 #include <optional>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -144,6 +146,10 @@ namespace Opm {
         void loadRestartNetworkPressures(const RestartIO::RstNetwork& network);
         const std::optional<std::map<std::string, double> >& getRestartNetworkPressures() const { return this->m_restart_network_pressures; }
 
+        /// Wall clock time, in seconds, spent in each phase of constructing
+        /// this object from a deck. Empty for objects created otherwise.
+        const std::vector<std::pair<std::string, double>>& initTimings() const { return this->m_init_timings; }
+
         template<class Serializer>
         void serializeOp(Serializer& serializer)
         {
@@ -172,6 +178,9 @@ namespace Opm {
         static bool rst_cmp(const EclipseState& full_state, const EclipseState& rst_state);
 
     private:
+        class Initializer;
+        EclipseState(const Deck& deck, Initializer&& init);
+
         void initIOConfigPostSchedule(const Deck& deck);
         void assignRunTitle(const Deck& deck);
         void reportNumberOfActivePhases() const;
@@ -211,6 +220,8 @@ namespace Opm {
         std::optional<std::map<std::string, double> > m_restart_network_pressures{std::nullopt};
 
         std::optional<FIPRegionStatistics> fipRegionStatistics_{std::nullopt};
+
+        std::vector<std::pair<std::string, double>> m_init_timings{};
     };
 } // namespace Opm
 
@@ -25,6 +25,8 @@
 #include <opm/input/eclipse/Deck/DeckItem.hpp>
 #include <opm/input/eclipse/Deck/DeckRecord.hpp>
 
+#include <array>
+#include <cstddef>
 #include <stdexcept>
 #include <utility>
 
@@ -141,6 +143,27 @@ namespace Opm
         assert_dims(this->m_globalGridDims_.getNY(), j1, j2, 'j');
         assert_dims(this->m_globalGridDims_.getNZ(), k1, k2, 'k');
 
+        const auto dims = std::array<std::size_t, 3> {
+            static_cast<std::size_t>(i2 - i1 + 1),
+            static_cast<std::size_t>(j2 - j1 + 1),
+            static_cast<std::size_t>(k2 - k1 + 1),
+        };
+
+        const auto offset = std::array<std::size_t, 3> {
+            static_cast<std::size_t>(i1),
+            static_cast<std::size_t>(j1),
+            static_cast<std::size_t>(k1),
+        };
+
+        // Decks frequently repeat the same box in consecutive records or
+        // keywords.  The index lists depend on the box only, so there is no
+        // need to rebuild them in that case.
+        if ((dims == this->m_dims) && (offset == this->m_offset) &&
+            (this->m_global_index_list.size() == this->size()))
+        {
+            return;
+        }
+
         this->m_dims[0] = static_cast<std::size_t>(i2 - i1 + 1);
         this->m_dims[1] = static_cast<std::size_t>(j2 - j1 + 1);
         this->m_dims[2] = static_cast<std::size_t>(k2 - k1 + 1);
@@ -184,22 +207,31 @@ namespace Opm
         this->m_active_index_list.clear();
         this->m_global_index_list.clear();
 
-        const auto boxdims = GridDims(this->m_dims[0], this->m_dims[1], this->m_dims[2]);
-        const auto ncells = boxdims.getCartesianSize();
+        this->m_global_index_list.reserve(this->size());
+        this->m_active_index_list.reserve(this->size());
 
-        for (auto data_index = 0*ncells; data_index != ncells; ++data_index) {
-            const auto boxIJK = boxdims.getIJK(data_index);
-            const auto global_index = this->m_globalGridDims_
-                .getGlobalIndex(boxIJK[0] + this->m_offset[0],
-                                boxIJK[1] + this->m_offset[1],
-                                boxIJK[2] + this->m_offset[2]);
+        // Traverse the box in data order, i.e., with the I index cycling
+        // fastest, which lets the global index be computed incrementally.
+        const auto nx = this->m_globalGridDims_.getNX();
+        const auto ny = this->m_globalGridDims_.getNY();
 
-            if (this->m_globalIsActive_(global_index)) {
-                const auto active_index = this->m_globalActiveIdx_(global_index);
-                this->m_active_index_list.emplace_back(global_index, active_index, data_index);
-            }
+        auto data_index = std::size_t{0};
+        for (auto k = 0*this->m_dims[2]; k < this->m_dims[2]; ++k) {
+            for (auto j = 0*this->m_dims[1]; j < this->m_dims[1]; ++j) {
+                const auto row_start = this->m_offset[0]
+                    + nx*((j + this->m_offset[1]) + ny*(k + this->m_offset[2]));
 
-            this->m_global_index_list.emplace_back(global_index, data_index);
+                for (auto i = 0*this->m_dims[0]; i < this->m_dims[0]; ++i, ++data_index) {
+                    const auto global_index = row_start + i;
+
+                    if (this->m_globalIsActive_(global_index)) {
+                        const auto active_index = this->m_globalActiveIdx_(global_index);
+                        this->m_active_index_list.emplace_back(global_index, active_index, data_index);
+                    }
+
+                    this->m_global_index_list.emplace_back(global_index, data_index);
+                }
+            }
         }
     }
 
@@ -124,8 +124,9 @@ namespace Opm {
                 OpmLog::warning("Fault pattern " + pattern + " has symbols after the asterisk."
                                 " Truncated to " + ptrunc);
             }
+            const auto fault_pattern = ShellPattern { ptrunc };
             for (const auto& fault : m_faults) {
-                if (shmatch(ptrunc, fault.first)) {
+                if (fault_pattern.match(fault.first)) {
                     names.push_back(fault.first);
                 }
             }
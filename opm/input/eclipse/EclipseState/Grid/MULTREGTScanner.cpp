@@ -34,6 +34,7 @@
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <map>
 #include <stdexcept>
 #include <string>
@@ -413,6 +414,196 @@ namespace Opm {
         return multiplier;
     }
 
+    // Flat form of the search maps of a single region set.  The record
+    // indices are kept in vectors sorted by region pair and region ID
+    // respectively, so the memory use is proportional to the number of
+    // records rather than to the number or range of the region IDs.
+    // Lookups return -1 if there is no record for a region or region pair.
+    struct MULTREGTScanner::RegionLookup
+    {
+        const std::vector<int>* region_data{nullptr};
+        std::vector<std::pair<std::pair<int, int>, int>> different{};
+        std::vector<std::pair<int, int>> same{};
+
+        int differentRecord(const int regionId1, const int regionId2) const
+        {
+            return find(this->different, std::pair { regionId1, regionId2 });
+        }
+
+        int sameRecord(const int regionId) const
+        {
+            return find(this->same, regionId);
+        }
+
+    private:
+        template <typename Key>
+        static int find(const std::vector<std::pair<Key, int>>& table, const Key& key)
+        {
+            const auto pos = std::lower_bound(table.begin(), table.end(), key,
+                                              [](const auto& entry, const Key& k)
+                                              { return entry.first < k; });
+
+            return ((pos == table.end()) || (pos->first != key)) ? -1 : pos->second;
+        }
+    };
+
+    std::vector<MULTREGTScanner::RegionLookup>
+    MULTREGTScanner::makeRegionLookups() const
+    {
+        auto lookups = std::vector<RegionLookup>{};
+        lookups.reserve(this->m_searchMap.size());
+
+        for (const auto& [regName, regMaps] : this->m_searchMap) {
+            auto& lookup = lookups.emplace_back();
+            lookup.region_data = &this->regions.at(regName);
+
+            // The search maps are ordered by region pair, so the tables
+            // come out sorted.
+            lookup.different.reserve(std::get<0>(regMaps).size());
+            for (const auto& [pair, recordIx] : std::get<0>(regMaps)) {
+                lookup.different.emplace_back(pair, static_cast<int>(recordIx));
+            }
+
+            lookup.same.reserve(std::get<1>(regMaps).size());
+            for (const auto& [pair, recordIx] : std::get<1>(regMaps)) {
+                lookup.same.emplace_back(pair.first, static_cast<int>(recordIx));
+            }
+        }
+
+        return lookups;
+    }
+
+    std::vector<double>
+    MULTREGTScanner::getRegionMultipliers(const std::vector<std::size_t>& globalCellIdx1,
+                                          const std::vector<std::size_t>& globalCellIdx2,
+                                          const std::vector<FaceDir::DirEnum>& faceDirs) const
+    {
+        if ((globalCellIdx1.size() != globalCellIdx2.size()) ||
+            (globalCellIdx1.size() != faceDirs.size()))
+        {
+            throw std::invalid_argument {
+                "Inconsistent number of connections in getRegionMultipliers()"
+            };
+        }
+
+        return this->template getRegionMultipliers<false>(globalCellIdx1, globalCellIdx2, faceDirs.data());
+    }
+
+    std::vector<double>
+    MULTREGTScanner::getRegionMultipliersNNC(const std::vector<std::size_t>& globalCellIdx1,
+                                             const std::vector<std::size_t>& globalCellIdx2) const
+    {
+        if (globalCellIdx1.size() != globalCellIdx2.size()) {
+            throw std::invalid_argument {
+                "Inconsistent number of connections in getRegionMultipliersNNC()"
+            };
+        }
+
+        return this->template getRegionMultipliers<true>(globalCellIdx1, globalCellIdx2, nullptr);
+    }
+
+    // Batch counterpart of getRegionMultiplier() and
+    // getRegionMultiplierNNC().  The records are applied in the same order
+    // as in those functions, so the results are identical.
+    template<bool isNNC>
+    std::vector<double>
+    MULTREGTScanner::getRegionMultipliers(const std::vector<std::size_t>& globalCellIdx1,
+                                          const std::vector<std::size_t>& globalCellIdx2,
+                                          const FaceDir::DirEnum* faceDirs) const
+    {
+        auto multipliers = std::vector<double>(globalCellIdx1.size(), 1.0);
+
+        if (this->m_searchMap.empty()) {
+            return multipliers;
+        }
+
+        const auto lookups = this->makeRegionLookups();
+        const auto numConn = static_cast<std::int64_t>(multipliers.size());
+
+        #pragma omp parallel for schedule(static)
+        for (std::int64_t conn = 0; conn < numConn; ++conn) {
+            const auto globalIndex1 = globalCellIdx1[conn];
+            const auto globalIndex2 = globalCellIdx2[conn];
+
+            const auto is_adj = !isNNC && is_adjacent(this->gridDims, globalIndex1, globalIndex2);
+            const auto is_aqu = this->isAquNNC(globalIndex1, globalIndex2);
+
+            auto applyMultiplier = [is_adj, is_aqu](const MULTREGTRecord& record)
+            {
+                const auto nnc_behaviour = record.nnc_behaviour;
+
+                if constexpr (isNNC) {
+                    return (nnc_behaviour != MULTREGT::NNCBehaviourEnum::NONNC)
+                        && !(is_aqu && (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NOAQUNNC));
+                }
+                else {
+                    return (nnc_behaviour == MULTREGT::NNCBehaviourEnum::ALL)
+                        || !(((is_adj && !is_aqu) && (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NNC))
+                             || ((!is_adj || is_aqu) && (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NONNC))
+                             || (is_aqu && (nnc_behaviour == MULTREGT::NNCBehaviourEnum::NOAQUNNC)));
+                }
+            };
+
+            auto apply = [&applyMultiplier, faceDirs, conn]
+                (const std::vector<MULTREGTRecord>& records, const int recordIx, double& multiplier)
+            {
+                if (recordIx < 0) {
+                    return;
+                }
+
+                const auto& record = records[recordIx];
+                if constexpr (!isNNC) {
+                    if ((record.directions & faceDirs[conn]) == 0) {
+                        return;
+                    }
+                }
+
+                if (applyMultiplier(record)) {
+                    multiplier *= record.trans_mult;
+                }
+            };
+
+            auto multiplier = 1.0;
+            for (const auto& lookup : lookups) {
+                const auto& region_data = *lookup.region_data;
+
+                auto regionId1 = region_data[globalIndex1];
+                auto regionId2 = region_data[globalIndex2];
+
+                if (regionId1 > regionId2) {
+                    std::swap(regionId1, regionId2);
+                }
+
+                auto applyDifferent = [&]()
+                {
+                    apply(this->m_records, lookup.differentRecord(regionId1, regionId2), multiplier);
+                };
+
+                auto applySame = [&]()
+                {
+                    apply(this->m_records_same, lookup.sameRecord(regionId1), multiplier);
+
+                    if (regionId1 != regionId2) {
+                        apply(this->m_records_same, lookup.sameRecord(regionId2), multiplier);
+                    }
+                };
+
+                if constexpr (isNNC) {
+                    applySame();
+                    applyDifferent();
+                }
+                else {
+                    applyDifferent();
+                    applySame();
+                }
+            }
+
+            multipliers[conn] = multiplier;
+        }
+
+        return multipliers;
+    }
+
     template<typename ApplyDecision, typename RegPairFound>
     double MULTREGTScanner::applyMultiplierDifferentRegion(const std::array<MULTREGTSearchMap,2>& regMaps,
                                                            double multiplier,
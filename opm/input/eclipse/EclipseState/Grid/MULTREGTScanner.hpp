@@ -109,6 +109,28 @@ namespace Opm {
         double getRegionMultiplierNNC(std::size_t globalCellIdx1,
                                       std::size_t globalCellIdx2) const;
 
+        /// \brief Region multipliers for a batch of connections
+        ///
+        /// Equivalent to calling getRegionMultiplier() for each connection,
+        /// but the region pair lookups are resolved through flat sorted
+        /// tables built once per call, and the connections are processed
+        /// in parallel if OpenMP is enabled.
+        ///
+        /// \param globalCellIdx1 First cell of each connection
+        /// \param globalCellIdx2 Second cell of each connection
+        /// \param faceDirs Face direction of each connection
+        /// \return Multiplier of each connection
+        std::vector<double>
+        getRegionMultipliers(const std::vector<std::size_t>& globalCellIdx1,
+                             const std::vector<std::size_t>& globalCellIdx2,
+                             const std::vector<FaceDir::DirEnum>& faceDirs) const;
+
+        /// \brief Batch version of getRegionMultiplierNNC(), see
+        /// getRegionMultipliers().
+        std::vector<double>
+        getRegionMultipliersNNC(const std::vector<std::size_t>& globalCellIdx1,
+                                const std::vector<std::size_t>& globalCellIdx2) const;
+
         template <class Serializer>
         void serializeOp(Serializer& serializer)
         {
@@ -170,6 +192,15 @@ namespace Opm {
         template<int index>
         void fillSearchMap(const std::vector<MULTREGTRecord>& records);
 
+        struct RegionLookup;
+        std::vector<RegionLookup> makeRegionLookups() const;
+
+        template<bool isNNC>
+        std::vector<double>
+        getRegionMultipliers(const std::vector<std::size_t>& globalCellIdx1,
+                             const std::vector<std::size_t>& globalCellIdx2,
+                             const FaceDir::DirEnum* faceDirs) const;
+
         GridDims gridDims{};
         const FieldPropsManager* fp{nullptr};
 
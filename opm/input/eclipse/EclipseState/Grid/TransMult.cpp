@@ -17,6 +17,7 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <stdexcept>
 
 #include <fmt/format.h>
@@ -121,6 +122,32 @@ namespace Opm {
         return m_multregtScanner.getRegionMultiplierNNC(globalCellIndex1, globalCellIndex2);
     }
 
+    std::vector<double> TransMult::getMultipliers(const std::vector<std::size_t>& globalIndex, FaceDir::DirEnum faceDir) const {
+        const auto global_size = m_nx * m_ny * m_nz;
+        if (std::any_of(globalIndex.begin(), globalIndex.end(),
+                        [global_size](const std::size_t ix) { return ix >= global_size; }))
+            throw std::invalid_argument("Invalid global index");
+
+        auto multipliers = std::vector<double>(globalIndex.size(), 1.0);
+        auto prop = m_trans.find(faceDir);
+        if (prop != m_trans.end())
+            std::transform(globalIndex.begin(), globalIndex.end(), multipliers.begin(),
+                           [&data = prop->second](const std::size_t ix) { return data[ix]; });
+
+        return multipliers;
+    }
+
+    std::vector<double> TransMult::getRegionMultipliers(const std::vector<std::size_t>& globalCellIndex1,
+                                                        const std::vector<std::size_t>& globalCellIndex2,
+                                                        const std::vector<FaceDir::DirEnum>& faceDirs) const {
+        return m_multregtScanner.getRegionMultipliers(globalCellIndex1, globalCellIndex2, faceDirs);
+    }
+
+    std::vector<double> TransMult::getRegionMultipliersNNC(const std::vector<std::size_t>& globalCellIndex1,
+                                                           const std::vector<std::size_t>& globalCellIndex2) const {
+        return m_multregtScanner.getRegionMultipliersNNC(globalCellIndex1, globalCellIndex2);
+    }
+
     bool TransMult::hasDirectionProperty(FaceDir::DirEnum faceDir) const {
         return m_trans.count(faceDir) == 1;
     }
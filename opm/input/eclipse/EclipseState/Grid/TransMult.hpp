@@ -33,6 +33,8 @@
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <opm/input/eclipse/EclipseState/Grid/FaceDir.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/MULTREGTScanner.hpp>
@@ -61,6 +63,15 @@ namespace Opm {
         double getMultiplier(size_t i , size_t j , size_t k, FaceDir::DirEnum faceDir) const;
         double getRegionMultiplier( size_t globalCellIndex1, size_t globalCellIndex2, FaceDir::DirEnum faceDir) const;
         double getRegionMultiplierNNC(std::size_t globalCellIndex1, std::size_t globalCellIndex2) const;
+
+        /// Batch versions of the above, for all connections at once.  See
+        /// MULTREGTScanner::getRegionMultipliers().
+        std::vector<double> getMultipliers(const std::vector<std::size_t>& globalIndex, FaceDir::DirEnum faceDir) const;
+        std::vector<double> getRegionMultipliers(const std::vector<std::size_t>& globalCellIndex1,
+                                                 const std::vector<std::size_t>& globalCellIndex2,
+                                                 const std::vector<FaceDir::DirEnum>& faceDirs) const;
+        std::vector<double> getRegionMultipliersNNC(const std::vector<std::size_t>& globalCellIndex1,
+                                                    const std::vector<std::size_t>& globalCellIndex2) const;
         void applyMULT(const std::vector<double>& srcMultProp, FaceDir::DirEnum faceDir);
         void applyMULTFLT(const FaultCollection& faults);
         void applyMULTFLT(const Fault& fault);
@@ -172,6 +172,7 @@ namespace Opm {
 
         result.m_output_enabled = false;
         result.ecl_compatible_rst = false;
+        result.m_write_restart_index = true;
 
         return result;
     }
@@ -230,6 +231,16 @@ namespace Opm {
         this->ecl_compatible_rst = ecl_rst;
     }
 
+    bool IOConfig::getWriteRestartIndex() const
+    {
+        return this->m_write_restart_index;
+    }
+
+    void IOConfig::setWriteRestartIndex(bool write_index)
+    {
+        this->m_write_restart_index = write_index;
+    }
+
     void IOConfig::overrideNOSIM(bool nosim)
     {
         m_nosim = nosim;
@@ -367,6 +378,7 @@ namespace Opm {
             && (this->initOnly() == data.initOnly())
             && (this->getBaseName() == data.getBaseName())
             && (this->getEclCompatibleRST() == data.getEclCompatibleRST())
+            && (this->getWriteRestartIndex() == data.getWriteRestartIndex())
             ;
     }
 
@@ -150,6 +150,12 @@ namespace Opm {
 
         void setEclCompatibleRST(bool ecl_rst);
         bool getEclCompatibleRST() const;
+
+        /// Whether to keep an index file, <file>.OPMIDX, of binary unified
+        /// restart files.  See EclIO::EclFile::writeIndex().  Off by default.
+        void setWriteRestartIndex(bool write_index);
+        bool getWriteRestartIndex() const;
+
         bool getWriteEGRIDFile() const;
         bool getWriteINITFile() const;
         bool getUNIFOUT() const;
@@ -208,6 +214,7 @@ namespace Opm {
 
             serializer(m_output_enabled);
             serializer(ecl_compatible_rst);
+            serializer(m_write_restart_index);
         }
 
     private:
@@ -235,6 +242,7 @@ namespace Opm {
 
         bool m_output_enabled { true };
         bool ecl_compatible_rst { true };
+        bool m_write_restart_index { false };
 
         IOConfig(const GRIDSection&,
                  const RUNSPECSection&,
@@ -150,12 +150,12 @@ namespace Opm {
             for (size_t recordIdx = 0; recordIdx < thpresft.size(); ++ recordIdx) {
                 const DeckRecord& record = thpresft.getRecord(recordIdx);
 
-                const std::string& faultName = record.getItem("FAULT_NAME").getTrimmedString(0);
+                const ShellPattern faultName(record.getItem("FAULT_NAME").getTrimmedString(0));
                 double thpresValue = record.getItem("VALUE").getSIDouble(0);
 
                 for (size_t faultIdx = 0; faultIdx < faults.size(); faultIdx++) {
                     auto& fault = faults.getFault(faultIdx);
-                    if (!shmatch(faultName, fault.getName()))
+                    if (!faultName.match(fault.getName()))
                         continue;
 
                     m_thresholdFaultTable[faultIdx] = thpresValue;
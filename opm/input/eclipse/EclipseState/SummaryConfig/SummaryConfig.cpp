@@ -606,6 +606,40 @@ inline std::array< int, 3 > getijk( const DeckRecord& record ) {
 }
 
 
+// Expand summary nodes for each of a set of wells concurrently.  Each well
+// gets its own node buffer, and the buffers are appended to 'list' in the
+// order of 'well_names', so the result is identical to expanding the wells
+// one at a time.  The 'expand' function must not throw.
+template <typename Expand>
+void expandPerWell(SummaryConfig::keyword_list&    list,
+                   const std::vector<std::string>& well_names,
+                   const Schedule&                 schedule,
+                   Expand&&                        expand)
+{
+    std::vector<const Well*> wells;
+    wells.reserve(well_names.size());
+    for (const auto& wname : well_names) {
+        wells.push_back(&schedule.getWellatEnd(wname));
+    }
+
+    std::vector<SummaryConfig::keyword_list> buffers(wells.size());
+
+    #pragma omp parallel for schedule(dynamic)
+    for (std::int64_t w = 0; w < static_cast<std::int64_t>(wells.size()); ++w) {
+        expand(*wells[w], buffers[w]);
+    }
+
+    std::size_t num_nodes = list.size();
+    for (const auto& buffer : buffers) {
+        num_nodes += buffer.size();
+    }
+
+    list.reserve(num_nodes);
+    for (auto& buffer : buffers) {
+        std::move(buffer.begin(), buffer.end(), std::back_inserter(list));
+    }
+}
+
 inline void keywordCL(SummaryConfig::keyword_list& list,
                       const ParseContext& parseContext,
                       ErrorGuard& errors,
@@ -628,32 +662,43 @@ inline void keywordCL(SummaryConfig::keyword_list& list,
         }
 
         const auto ijk_defaulted = record.getItem(1).defaultApplied(0);
+        if (ijk_defaulted) {
+            expandPerWell(list, well_names, schedule,
+                          [&node](const Well& well, SummaryConfig::keyword_list& buffer)
+                          {
+                              const auto& all_connections = well.getConnections();
+
+                              auto well_node = node;
+                              well_node.namedEntity(well.name());
+                              buffer.reserve(all_connections.size());
+                              std::transform(all_connections.begin(), all_connections.end(),
+                                             std::back_inserter(buffer),
+                                             [&well_node](const auto& conn)
+                                             {
+                                                 return well_node.number(1 + conn.global_index());
+                                             });
+                          });
+
+            continue;
+        }
+
         for (const auto& wname : well_names) {
             const auto& well = schedule.getWellatEnd(wname);
             const auto& all_connections = well.getConnections();
 
             node.namedEntity(wname);
-            if (ijk_defaulted) {
-                std::transform(all_connections.begin(), all_connections.end(),
-                               std::back_inserter(list),
-                               [&node](const auto& conn)
-                               {
-                                    return node.number(1 + conn.global_index());
-                               });
+            const auto& ijk = getijk(record);
+            auto global_index = dims.getGlobalIndex(ijk[0], ijk[1], ijk[2]);
+
+            if (all_connections.hasGlobalIndex(global_index)) {
+                const auto& conn = all_connections.getFromGlobalIndex(global_index);
+                list.push_back( node.number( 1 + conn.global_index()));
             } else {
-                const auto& ijk = getijk(record);
-                auto global_index = dims.getGlobalIndex(ijk[0], ijk[1], ijk[2]);
-
-                if (all_connections.hasGlobalIndex(global_index)) {
-                    const auto& conn = all_connections.getFromGlobalIndex(global_index);
-                    list.push_back( node.number( 1 + conn.global_index()));
-                } else {
-                    std::string msg = fmt::format("Problem with keyword {{keyword}}\n"
-                                                  "In {{file}} line {{line}}\n"
-                                                  "Connection ({},{},{}) not defined for well {}",
-                                                  ijk[0] + 1, ijk[1] + 1, ijk[2] + 1, wname);
-                    parseContext.handleError( ParseContext::SUMMARY_UNHANDLED_KEYWORD, msg, keyword.location(), errors);
-                }
+                std::string msg = fmt::format("Problem with keyword {{keyword}}\n"
+                                              "In {{file}} line {{line}}\n"
+                                              "Connection ({},{},{}) not defined for well {}",
+                                              ijk[0] + 1, ijk[1] + 1, ijk[2] + 1, wname);
+                parseContext.handleError( ParseContext::SUMMARY_UNHANDLED_KEYWORD, msg, keyword.location(), errors);
             }
         }
     }
@@ -1175,9 +1220,15 @@ inline void keywordMISC( SummaryConfig::keyword_list& list,
         if( well_names.empty() )
             handleMissingWell( parseContext, errors, keyword.location(), wellitem.getTrimmedString( 0 ) );
 
-        for(const auto& name : well_names) {
-            param.namedEntity(name);
-            const auto& well = schedule.getWellatEnd(name);
+        const auto record_ijk = ijk_defaulted
+            ? std::array<int, 3>{} : getijk(record);
+
+        expandPerWell(list, well_names, schedule,
+                      [&param, ijk_defaulted, &record_ijk, &dims]
+                      (const Well& well, SummaryConfig::keyword_list& buffer)
+        {
+            auto well_param = param;
+            well_param.namedEntity(well.name());
             /*
              * we don't want to add connections that don't exist, so we iterate
              * over a well's connections regardless of the desired block is
@@ -1186,12 +1237,12 @@ inline void keywordMISC( SummaryConfig::keyword_list& list,
             for( const auto& connection : well.getConnections() ) {
                 auto cijk = getijk( connection );
 
-                if( ijk_defaulted || ( cijk == getijk(record) ) ) {
+                if( ijk_defaulted || ( cijk == record_ijk ) ) {
                     const int global_index = 1 + dims.getGlobalIndex(cijk[0], cijk[1], cijk[2]);
-                    list.push_back( param.number(global_index) );
+                    buffer.push_back( well_param.number(global_index) );
                 }
             }
-        }
+        });
     }
 }
 
@@ -1280,9 +1331,9 @@ inline void keywordMISC( SummaryConfig::keyword_list& list,
 
         const auto segID = -1;
 
-        for (const auto& well : schedule.getWellsatEnd()) {
-            makeSegmentNodes(segID, keyword, well, list);
-        }
+        expandPerWell(list, schedule.wellNames(), schedule,
+                      [&keyword](const Well& well, SummaryConfig::keyword_list& buffer)
+                      { makeSegmentNodes(segID, keyword, well, buffer); });
     }
 
     void keywordSWithRecords(const ParseContext&          parseContext,
@@ -1323,9 +1374,9 @@ inline void keywordMISC( SummaryConfig::keyword_list& list,
             const auto segID = record.getItem(1).defaultApplied(0)
                 ? -1 : record.getItem(1).get<int>(0);
 
-            for (const auto& well_name : well_names) {
-                makeSegmentNodes(segID, keyword, schedule.getWellatEnd(well_name), list);
-            }
+            expandPerWell(list, well_names, schedule,
+                          [segID, &keyword](const Well& well, SummaryConfig::keyword_list& buffer)
+                          { makeSegmentNodes(segID, keyword, well, buffer); });
         }
     }
 
@@ -2027,10 +2078,7 @@ const SummaryConfigNode& SummaryConfig::operator[](std::size_t index) const {
 bool SummaryConfig::match(const std::string& keywordPattern) const
 {
     return std::any_of(this->short_keywords.begin(), this->short_keywords.end(),
-                        [&keywordPattern](const auto& keyword)
-                        {
-                            return shmatch(keywordPattern, keyword);
-                        });
+                       ShellPattern { keywordPattern });
 }
 
 SummaryConfig::keyword_list
@@ -2040,8 +2088,8 @@ SummaryConfig::keywords(const std::string& keywordPattern) const
 
     std::copy_if(this->m_keywords.begin(), this->m_keywords.end(),
                  std::back_inserter(kw_list),
-                 [&keywordPattern](const auto& kw)
-                 { return shmatch(keywordPattern, kw.keyword()); });
+                 [pattern = ShellPattern { keywordPattern }](const auto& kw)
+                 { return pattern.match(kw.keyword()); });
 
     return kw_list;
 }
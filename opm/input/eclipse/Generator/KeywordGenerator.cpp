@@ -25,14 +25,17 @@
 
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
 
+#include <algorithm>
 #include <cctype>
 #include <filesystem>
 #include <fstream>
 #include <map>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
+#include <fmt/ranges.h>
 
 namespace {
 
@@ -120,6 +123,7 @@ namespace Opm {
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
 #include <unordered_map>
 #include <fmt/format.h>
+#include <fmt/ranges.h>
 )";
 
         for (const auto& kw_pair : loader) {
@@ -254,7 +258,22 @@ void Opm::ParserKeywords::addDefaultKeywords{0}([[maybe_unused]] Parser& p)
                                      first_char);
 
             for (const auto& kw : keywords) {
-                sourceStr << fmt::format("    p.addParserKeyword({}{{}});", kw.className()) << '\n';
+                // Keywords recognised by regular expression, and code
+                // keywords, must be available when parsing starts.  All
+                // others are only instantiated on first lookup.
+                if (kw.hasMatchRegex() || kw.isCodeKeyword()) {
+                    sourceStr << fmt::format("    p.addParserKeyword({}{{}});", kw.className()) << '\n';
+                    continue;
+                }
+
+                auto deck_names = std::vector<std::string> {
+                    kw.deck_names().begin(), kw.deck_names().end()
+                };
+                std::sort(deck_names.begin(), deck_names.end());
+
+                sourceStr << fmt::format("    p.addBuiltinKeyword<{}>({{ \"{}\" }});",
+                                         kw.className(), fmt::join(deck_names, "\", \""))
+                          << '\n';
             }
 
             // End of Opm::ParserKeywords::addDefaultKeywords{0}()
@@ -397,6 +416,7 @@ void python::common::export_ParserKeywords(py::module& module)
 #include <cstddef>
 #include <filesystem>
 #include <string>
+#include <vector>
 
 namespace {
 
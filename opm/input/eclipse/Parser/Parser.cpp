@@ -59,7 +59,9 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstddef>
 #include <cstdio>
+#include <cstring>
 #include <filesystem>
 #include <iostream>
 #include <iterator>
@@ -298,32 +300,40 @@ inline bool getline( std::string_view& input, std::string_view& line ) {
     return true;
 }
 
+/*
+ * Append the range [first, first + size) at 'dst', which never lies after
+ * 'first' when cleaning a buffer in place, and return the new end.
+ */
+inline char* append_in_place( char* dst, const char* first, const std::size_t size ) {
+    if (dst != first)
+        std::memmove( dst, first, size );
+
+    return dst + size;
+}
+
 /*
  * Read the input file and remove everything that isn't interesting data,
  * including stripping comments, removing leading/trailing whitespaces and
- * everything after (terminating) slashes. Manually copying into the string for
- * performance.
+ * everything after (terminating) slashes. The cleaned text is never longer
+ * than what has been read so far, so the input buffer is reused for the
+ * output instead of holding a second copy of the whole file.
  */
-inline std::string fast_clean( const std::string& str ) {
-    std::string dst;
-    dst.resize( str.size() );
-
+inline std::string fast_clean( std::string str ) {
     std::string_view input( str ), line;
-    auto dsti = dst.begin();
+    auto* dsti = str.data();
     while( true ) {
 
         if ( getline( input, line ) ) {
             line = trim( strip_comments(line));
 
-            std::copy( line.begin(), line.end(), dsti );
-            dsti += std::distance( line.begin(), line.end() );
+            dsti = append_in_place( dsti, line.data(), line.size() );
             *dsti++ = '\n';
         } else
             break;
     }
 
-    dst.resize( std::distance( dst.begin(), dsti ) );
-    return dst;
+    str.resize( std::distance( str.data(), dsti ) );
+    return str;
 }
 
 inline bool starts_with(const std::string_view& view, const std::string& str) {
@@ -347,20 +357,17 @@ inline bool starts_with(const std::string_view& view, const std::string& str) {
     }
 }
 
-inline std::string clean( const std::vector<std::pair<std::string, std::string>>& code_keywords, const std::string& str ) {
+inline std::string clean( const std::vector<std::pair<std::string, std::string>>& code_keywords, std::string str ) {
     auto count = std::count_if(code_keywords.begin(), code_keywords.end(), [&str](const std::pair<std::string, std::string>& code_pair)
                                                                   {
                                                                      return str.find(code_pair.first) != std::string::npos;
                                                                    });
 
     if (count == 0)
-        return fast_clean(str);
+        return fast_clean(std::move(str));
     else {
-        std::string dst;
-        dst.resize( str.size() );
-
         std::string_view input( str ), line;
-        auto dsti = dst.begin();
+        auto* dsti = str.data();
         while( true ) {
             for (const auto& code_pair : code_keywords) {
                 const auto& keyword = code_pair.first;
@@ -369,14 +376,12 @@ inline std::string clean( const std::vector<std::pair<std::string, std::string>>
                     std::string end_string = code_pair.second;
                     auto end_pos = input.find(end_string);
                     if (end_pos == std::string::npos) {
-                        std::copy(input.begin(), input.end(), dsti);
-                        dsti += std::distance( input.begin(), input.end() );
+                        dsti = append_in_place( dsti, input.data(), input.size() );
                         input = {};
                         break;
                     } else {
                         end_pos += end_string.size();
-                        std::copy(input.begin(), input.begin() + end_pos, dsti);
-                        dsti += end_pos;
+                        dsti = append_in_place( dsti, input.data(), end_pos );
                         *dsti++ = '\n';
                         input.remove_prefix(end_pos + 1);
                         break;
@@ -387,15 +392,14 @@ inline std::string clean( const std::vector<std::pair<std::string, std::string>>
             if ( getline( input, line ) ) {
                 line = trim( strip_comments(line));
 
-                std::copy( line.begin(), line.end(), dsti );
-                dsti += std::distance( line.begin(), line.end() );
+                dsti = append_in_place( dsti, line.data(), line.size() );
                 *dsti++ = '\n';
             } else
                 break;
         }
 
-        dst.resize( std::distance( dst.begin(), dsti ) );
-        return dst;
+        str.resize( std::distance( str.data(), dsti ) );
+        return str;
     }
 }
 
@@ -657,7 +661,7 @@ void ParserState::loadFile(const std::filesystem::path& inputFile) {
         throw std::runtime_error( "Error when reading input file '"
                                   + inputFile.string() + "'" );
 
-    this->input_stack.push( str::clean( this->code_keywords, buffer ), inputFile );
+    this->input_stack.push( str::clean( this->code_keywords, std::move(buffer) ), inputFile );
 }
 
 /*
@@ -1416,7 +1420,7 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         if( parser.isRecognizedKeyword( rawKeyword->getKeywordName() ) ) {
             const auto& kwname = rawKeyword->getKeywordName();
             const auto& parserKeyword = parser.getParserKeywordFromDeckName( kwname );
-            {
+            if (OpmLog::isActive(Log::MessageType::Info)) {
                 const auto& location = rawKeyword->location();
                 auto msg = fmt::format("{:5} Reading {:<8} in {} line {}", parserState.deck.size(), rawKeyword->getKeywordName(), location.filename, location.lineno);
                 OpmLog::info(msg);
@@ -1689,11 +1693,11 @@ void Parser::addParserKeyword( ParserKeyword parserKeyword ) {
      *   same sweep.
      */
 
-    this->keyword_storage.push_back( std::move( parserKeyword ) );
-    const ParserKeyword * ptr = std::addressof(this->keyword_storage.back());
+    const auto& entry = this->keyword_storage.emplace_back( std::move( parserKeyword ) );
+    const ParserKeyword * ptr = std::addressof(entry.get());
     for (const auto& deck_name : ptr->deck_names())
     {
-        m_deckParserKeywords[deck_name] = ptr;
+        m_deckParserKeywords[deck_name] = &entry;
     }
 
     if (ptr->hasMatchRegex()) {
@@ -1706,6 +1710,30 @@ void Parser::addParserKeyword( ParserKeyword parserKeyword ) {
 }
 
 
+void Parser::addBuiltinKeyword(std::initializer_list<std::string_view> deckNames,
+                               ParserKeyword (*factory)())
+{
+    const auto& entry = this->keyword_storage.emplace_back( factory );
+    for (const auto& deck_name : deckNames)
+        m_deckParserKeywords[deck_name] = &entry;
+}
+
+Parser::KeywordEntry::KeywordEntry(ParserKeyword keyword)
+    : m_keyword( std::move(keyword) )
+{}
+
+Parser::KeywordEntry::KeywordEntry(ParserKeyword (*factory)())
+    : m_factory( factory )
+{}
+
+const ParserKeyword& Parser::KeywordEntry::get() const {
+    // Lookups are const and may happen concurrently, hence call_once().
+    if (this->m_factory != nullptr)
+        std::call_once(this->m_created, [this]() { this->m_keyword.emplace( this->m_factory() ); });
+
+    return *this->m_keyword;
+}
+
 void Parser::addParserKeyword(const Json::JsonObject& jsonKeyword) {
     addParserKeyword( ParserKeyword( jsonKeyword ) );
 }
@@ -1722,7 +1750,7 @@ const ParserKeyword& Parser::getKeyword( const std::string& name ) const {
 const ParserKeyword& Parser::getParserKeywordFromDeckName(const std::string_view& name ) const {
     auto candidate = m_deckParserKeywords.find( name );
 
-    if( candidate != m_deckParserKeywords.end() ) return *candidate->second;
+    if( candidate != m_deckParserKeywords.end() ) return candidate->second->get();
 
     const auto* wildCardKeyword = matchingKeyword( name );
 
@@ -1737,6 +1765,7 @@ std::vector<std::string> Parser::getAllDeckNames () const {
     for (auto iterator = m_deckParserKeywords.begin(); iterator != m_deckParserKeywords.end(); iterator++) {
         keywords.push_back(std::string(iterator->first));
     }
+    std::sort(keywords.begin(), keywords.end());
     for (auto iterator = m_wildCardKeywords.begin(); iterator != m_wildCardKeywords.end(); iterator++) {
         keywords.push_back(std::string(iterator->first));
     }
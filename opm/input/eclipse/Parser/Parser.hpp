@@ -21,11 +21,16 @@
 #define OPM_PARSER_HPP
 
 #include <filesystem>
+#include <initializer_list>
 #include <iosfwd>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -142,6 +147,22 @@ namespace Opm {
             addParserKeyword( T() );
         }
 
+        /// Register a keyword which is only instantiated the first time it
+        /// is looked up.  Used for the builtin keywords, most of which are
+        /// never seen by a given run.
+        ///
+        /// \param[in] deckNames All deck names of the keyword.  The names
+        /// must refer to storage which outlives the parser, typically
+        /// string literals.  Keywords matching a regular expression or
+        /// containing code must be added with addParserKeyword().
+        template <class T>
+        void addBuiltinKeyword(std::initializer_list<std::string_view> deckNames) {
+            addBuiltinKeyword( deckNames, []() -> ParserKeyword { return T(); } );
+        }
+
+        void addBuiltinKeyword(std::initializer_list<std::string_view> deckNames,
+                               ParserKeyword (*factory)());
+
         static EclipseState parse(const Deck& deck,            const ParseContext& context);
         static EclipseState parse(const std::string &filename, const ParseContext& context, ErrorGuard& errors);
         static EclipseState parseData(const std::string &data, const ParseContext& context, ErrorGuard& errors);
@@ -173,11 +194,24 @@ namespace Opm {
         const ParserKeyword* matchingKeyword(const std::string_view& keyword) const;
         void addDefaultKeywords();
 
-        // std::vector< std::unique_ptr< const ParserKeyword > > keyword_storage;
-        std::list<ParserKeyword> keyword_storage;
+        // Keyword object, possibly created on first use from 'factory'.
+        class KeywordEntry {
+        public:
+            explicit KeywordEntry(ParserKeyword keyword);
+            explicit KeywordEntry(ParserKeyword (*factory)());
+
+            const ParserKeyword& get() const;
+
+        private:
+            ParserKeyword (*m_factory)() = nullptr;
+            mutable std::once_flag m_created;
+            mutable std::optional<ParserKeyword> m_keyword;
+        };
+
+        std::list<KeywordEntry> keyword_storage;
 
         // associative map of deck names and the corresponding ParserKeyword object
-        std::map< std::string_view, const ParserKeyword* > m_deckParserKeywords;
+        std::unordered_map< std::string_view, const KeywordEntry* > m_deckParserKeywords;
 
         // associative map of the parser internal names and the corresponding
         // ParserKeyword object for keywords which match a regular expression
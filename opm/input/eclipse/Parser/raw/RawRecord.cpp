@@ -24,7 +24,8 @@
 #include "RawConsts.hpp"
 
 #include <algorithm>
-#include <deque>
+#include <cstddef>
+#include <stdexcept>
 
 #include <fmt/format.h>
 
@@ -35,34 +36,6 @@ namespace Opm {
 
 namespace {
 
-std::deque< std::string_view > splitSingleRecordString( const std::string_view& record ) {
-    auto first_nonspace = []( std::string_view::const_iterator begin,
-                              std::string_view::const_iterator end ) {
-        return std::find_if_not( begin, end, RawConsts::is_separator() );
-    };
-
-    std::deque< std::string_view > dst;
-    auto current = record.begin();
-    while( (current = first_nonspace( current, record.end() )) != record.end() )
-    {
-        if( *current == RawConsts::quote ) {
-            auto quote_end = std::find( current + 1, record.end(), RawConsts::quote ) + 1;
-            const std::size_t beg = std::distance(record.begin(), current);
-            const std::size_t size = std::distance(current, quote_end);
-            dst.push_back(record.substr(beg, size));
-            current = quote_end;
-        } else {
-            auto token_end = std::find_if( current, record.end(), RawConsts::is_separator() );
-            const std::size_t beg = std::distance(record.begin(), current);
-            const std::size_t size = std::distance(current, token_end);
-            dst.push_back(record.substr(beg, size));
-            current = token_end;
-        }
-    }
-
-    return dst;
-}
-
 /*
     * It is assumed that after a record is terminated, there is no quote marks
     * in the subsequent comment. This is in accordance with the Eclipse user
@@ -78,23 +51,37 @@ inline bool even_quotes( const T& str ) {
     return std::count( str.begin(), str.end(), RawConsts::quote ) % 2 == 0;
 }
 
+std::size_t first_nonspace( const std::string_view& record, const std::size_t pos ) {
+    return std::find_if_not( record.begin() + pos, record.end(), RawConsts::is_separator() ) - record.begin();
+}
+
 }
 
     RawRecord::RawRecord(const std::string_view& singleRecordString, const KeywordLocation& location, bool text) :
         m_sanitizedRecordString( singleRecordString )
     {
 
-        if (text)
-            this->m_recordItems.push_back(this->m_sanitizedRecordString);
+        if (text) {
+            this->m_front.emplace_back(this->m_sanitizedRecordString, 1);
+            this->m_position = this->m_sanitizedRecordString.size();
+            this->m_size = 1;
+        }
         else {
-            this->m_recordItems = splitSingleRecordString( m_sanitizedRecordString );
-
             if( !even_quotes( singleRecordString ) ) {
                 std::string error = fmt::format("Quotes are not balanced in: \"{}\"", std::string(singleRecordString));
                 throw OpmInputError(error, location);
             }
+
+            // Count the tokens, they are split off as they are popped.
+            const auto& record = this->m_sanitizedRecordString;
+            for (auto pos = first_nonspace( record, 0 );
+                 pos < record.size();
+                 pos = first_nonspace( record, this->scan( pos ).second ))
+            {
+                ++this->m_size;
+            }
         }
-        this->m_max_size = this->m_recordItems.size();
+        this->m_max_size = this->m_size;
     }
 
     RawRecord::RawRecord(const std::string_view& singleRecordString, const KeywordLocation& location) :
@@ -102,7 +89,10 @@ inline bool even_quotes( const T& str ) {
     {}
 
     void RawRecord::push_front( std::string_view tok, std::size_t count ) {
-        this->m_recordItems.insert( this->m_recordItems.begin(), count, tok );
+        if (count > 0)
+            this->m_front.emplace_front( tok, count );
+
+        this->m_size += count;
         this->m_max_size += count;
     }
 
@@ -113,4 +103,15 @@ inline bool even_quotes( const T& str ) {
     std::size_t RawRecord::max_size() const {
         return this->m_max_size;
     }
+
+    std::string_view RawRecord::getItem(size_t index) const {
+        if (index >= this->size())
+            throw std::out_of_range( fmt::format("Record has no item {}", index) );
+
+        auto rest = *this;
+        for (size_t i = 0; i < index; ++i)
+            rest.pop_front();
+
+        return rest.front();
+    }
 }
@@ -20,10 +20,15 @@
 #ifndef RECORD_HPP
 #define RECORD_HPP
 
+#include "RawConsts.hpp"
+
+#include <algorithm>
+#include <cstddef>
 #include <deque>
 #include <memory>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <list>
 
 namespace Opm {
@@ -32,6 +37,11 @@ class KeywordLocation;
     /// Class representing the lowest level of the Raw datatypes, a record. A record is simply
     /// a vector containing the record elements, represented as strings. Some logic is present
     /// to handle special elements in a record string, particularly with quote characters.
+    ///
+    /// The tokens are not stored, but split off the record string as they are
+    /// popped, so large numeric records go straight into the deck items
+    /// without a token list.  Only the count of remaining tokens is kept, and
+    /// tokens pushed back to the front are kept as (token, count) runs.
 
     class RawRecord {
     public:
@@ -45,36 +55,61 @@ class KeywordLocation;
         std::size_t max_size() const;
 
         std::string getRecordString() const;
-        inline std::string_view getItem(size_t index) const;
+        std::string_view getItem(size_t index) const;
 
     private:
         std::string_view m_sanitizedRecordString;
-        std::deque< std::string_view > m_recordItems;
+        std::deque< std::pair<std::string_view, std::size_t> > m_front;
+        std::size_t m_position = 0;
+        std::size_t m_size = 0;
         std::size_t m_max_size;
+
+        // Next token in the record string at or after 'pos', and the position
+        // following it.  The record string must not have unbalanced quotes.
+        inline std::pair<std::string_view, std::size_t> scan(std::size_t pos) const;
     };
 
     /*
      * These are frequently called, but fairly trivial in implementation, and
      * inlining the calls gives a decent low-effort performance benefit.
      */
+    std::pair<std::string_view, std::size_t> RawRecord::scan(std::size_t pos) const {
+        const auto& record = this->m_sanitizedRecordString;
+        const auto begin = std::find_if_not( record.begin() + pos, record.end(), RawConsts::is_separator() );
+        const auto end = (*begin == RawConsts::quote)
+            ? std::find( begin + 1, record.end(), RawConsts::quote ) + 1
+            : std::find_if( begin, record.end(), RawConsts::is_separator() );
+
+        return { record.substr(begin - record.begin(), end - begin),
+                 static_cast<std::size_t>(end - record.begin()) };
+    }
+
     std::string_view RawRecord::pop_front() {
-        auto result = m_recordItems.front();
-        this->m_recordItems.pop_front();
-        return result;
+        --this->m_size;
+
+        if (!this->m_front.empty()) {
+            auto& [token, count] = this->m_front.front();
+            const auto result = token;
+            if (--count == 0)
+                this->m_front.pop_front();
+
+            return result;
+        }
+
+        const auto [token, next] = this->scan( this->m_position );
+        this->m_position = next;
+        return token;
     }
 
     std::string_view RawRecord::front() const {
-        return this->m_recordItems.front();
+        return this->m_front.empty()
+            ? this->scan( this->m_position ).first
+            : this->m_front.front().first;
     }
 
     size_t RawRecord::size() const {
-        return m_recordItems.size();
-    }
-
-    std::string_view RawRecord::getItem(size_t index) const {
-        return this->m_recordItems.at( index );
+        return this->m_size;
     }
 }
 
 #endif  /* RECORD_HPP */
-
@@ -388,8 +388,7 @@ Opm::Action::ASTNode::getWellList(const Context& context) const
     wnames.reserve(wells.size());
 
     std::copy_if(wells.begin(), wells.end(), std::back_inserter(wnames),
-                 [wpatt = normalisePattern(this->arg_list.front())]
-                 (const auto& well) { return shmatch(wpatt, well); });
+                 ShellPattern { normalisePattern(this->arg_list.front()) });
 
     return wnames;
 }
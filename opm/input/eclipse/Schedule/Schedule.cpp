@@ -123,12 +123,18 @@
 
 namespace {
 
-    bool name_match_any(const std::unordered_set<std::string>& patterns,
+    std::vector<Opm::ShellPattern>
+    compile_patterns(const std::unordered_set<std::string>& patterns)
+    {
+        return { patterns.begin(), patterns.end() };
+    }
+
+    bool name_match_any(const std::vector<Opm::ShellPattern>& patterns,
                         const std::string& name)
     {
         return std::any_of(patterns.begin(), patterns.end(),
                            [&name](const auto& pattern)
-                           { return Opm::shmatch(pattern, name); });
+                           { return pattern.match(name); });
     }
 }
 
@@ -1255,12 +1261,13 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
 
     std::vector<Well> Schedule::getActiveWellsAtEnd() const {
         std::vector<Well> wells;
+        const auto wellopen_patterns = compile_patterns(this->potential_wellopen_patterns);
         const auto lastStep = this->snapshots.size() - 1;
         const auto& well_order = this->snapshots[lastStep].well_order();
 
         for (const auto& wname : well_order) {
             const auto& well = this->snapshots[lastStep].wells.get(wname);
-            if (well.hasProduced() || well.hasInjected() || name_match_any(this->potential_wellopen_patterns, wname))
+            if (well.hasProduced() || well.hasInjected() || name_match_any(wellopen_patterns, wname))
                 wells.push_back(well);
         }
 
@@ -1269,12 +1276,13 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
 
     std::vector<std::string> Schedule::getInactiveWellNamesAtEnd() const {
         std::vector<std::string> well_names;
+        const auto wellopen_patterns = compile_patterns(this->potential_wellopen_patterns);
         const auto lastStep = this->snapshots.size() - 1;
         const auto& well_order = this->snapshots[lastStep].well_order();
 
         for (const auto& wname : well_order) {
             const auto& well = this->snapshots[lastStep].wells.get(wname);
-            if (well.hasProduced() || well.hasInjected() || name_match_any(this->potential_wellopen_patterns, wname))
+            if (well.hasProduced() || well.hasInjected() || name_match_any(wellopen_patterns, wname))
                 continue;
             well_names.push_back(wname);
         }
@@ -84,9 +84,19 @@ namespace {
             && (keyword.compare(0, 2, "SU") == 0);
     }
 
-    bool is_total(const std::string& key)
+    // Key "VAR:NAME" in the values map of a well or group variable.  The
+    // buffer is reused between calls, so repeated updates of an existing
+    // variable do not allocate.
+    const std::string& var_key(const std::string& var, const std::string& name)
     {
-        static const std::vector<std::string> totals = {
+        thread_local std::string key;
+        key.assign(var).append(1, ':').append(name);
+        return key;
+    }
+
+    bool is_total(std::string_view key)
+    {
+        static constexpr std::string_view totals[] = {
             "OPT"  , "GPT"  , "WPT" , "GIT", "WIT", "OPTF" , "OPTS" , "OIT"  , "OVPT" , "OVIT" , "MWT" ,
             "WVPT" , "WVIT" , "GMT"  , "GPTF" , "SGT"  , "GST" , "FGT" , "GCT" , "GIMT" ,
             "WGPT" , "WGIT" , "EGT"  , "EXGT" , "GVPT" , "GVIT" , "LPT" , "VPT" , "VIT" , "NPT" , "NIT",
@@ -103,8 +113,8 @@ namespace {
         if (sep_pos == 0)
             return false;
 
-        if (sep_pos == std::string::npos) {
-            return std::any_of(totals.begin(), totals.end(),
+        if (sep_pos == std::string_view::npos) {
+            return std::any_of(std::begin(totals), std::end(totals),
                                [&key](const auto& total)
                                {
                                    return key.compare(1, total.size(), total) == 0;
@@ -356,8 +366,9 @@ namespace Opm
                                        const std::string& var,
                                        const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}", var, well)];
-        auto& wval_ref = this->well_values[var][well];
+        auto& val_ref  = this->values[var_key(var, well)];
+        auto [wellPos, is_new] = this->well_values[var].try_emplace(well, 0.0);
+        auto& wval_ref = wellPos->second;
 
         if (is_total(var)) {
             val_ref  += value;
@@ -367,8 +378,9 @@ namespace Opm
             val_ref = wval_ref = value;
         }
 
-        if (this->m_wells.count(well) == 0) {
-            this->m_wells.insert(well);
+        // Every well with an entry in well_values is already in m_wells, so the
+        // ordered set is only consulted the first time a (well,var) pair is seen.
+        if (is_new && this->m_wells.insert(well).second) {
             this->well_names.reset();
         }
     }
@@ -377,8 +389,9 @@ namespace Opm
                                         const std::string& var,
                                         const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}", var, group)];
-        auto& gval_ref = this->group_values[var][group];
+        auto& val_ref  = this->values[var_key(var, group)];
+        auto [groupPos, is_new] = this->group_values[var].try_emplace(group, 0.0);
+        auto& gval_ref = groupPos->second;
 
         if (is_total(var)) {
             val_ref  += value;
@@ -388,8 +401,9 @@ namespace Opm
             val_ref = gval_ref = value;
         }
 
-        if (this->m_groups.count(group) == 0) {
-            this->m_groups.insert(group);
+        // Every group with an entry in group_values is already in m_groups, so the
+        // ordered set is only consulted the first time a (group,var) pair is seen.
+        if (is_new && this->m_groups.insert(group).second) {
             this->group_names.reset();
         }
     }
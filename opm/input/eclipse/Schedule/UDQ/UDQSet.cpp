@@ -319,9 +319,11 @@ std::size_t UDQSet::size() const
 
 void UDQSet::assign(const std::string& wgname, const double value)
 {
+    const auto pattern = ShellPattern { wgname };
+
     bool assigned = false;
     for (auto& udq_value : this->values) {
-        if (shmatch(wgname, udq_value.wgname())) {
+        if (pattern.match(udq_value.wgname())) {
             udq_value.assign(value);
             assigned = true;
         }
@@ -342,9 +344,11 @@ void UDQSet::assign(const std::size_t index, const std::optional<double>& value)
 void UDQSet::assign(const std::string&           wgname,
                     const std::optional<double>& value)
 {
+    const auto pattern = ShellPattern { wgname };
+
     bool assigned = false;
     for (auto& udq_value : this->values) {
-        if (shmatch(wgname, udq_value.wgname())) {
+        if (pattern.match(udq_value.wgname())) {
             udq_value.assign(value);
             assigned = true;
         }
@@ -361,10 +365,11 @@ void UDQSet::assign(const std::string&           wgname,
                     const std::size_t            number,
                     const std::optional<double>& value)
 {
+    const auto pattern = ShellPattern { wgname };
     auto assigned = false;
 
     for (auto& udq : this->values) {
-        if ((udq.number() == number) && shmatch(wgname, udq.wgname())) {
+        if ((udq.number() == number) && pattern.match(udq.wgname())) {
             udq.assign(value);
             assigned = true;
         }
@@ -0,0 +1,395 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/VFPInterpolation.hpp>
+
+#include <opm/input/eclipse/Schedule/VFPInjTable.hpp>
+#include <opm/input/eclipse/Schedule/VFPProdTable.hpp>
+
+#include <algorithm>
+#include <cstddef>
+
+namespace Opm {
+
+namespace {
+
+template <std::size_t N>
+using Corners = std::array<double, std::size_t{1} << N>;
+
+template <std::size_t N>
+using Positions = std::array<VFPAxis::Position, N>;
+
+// Gather the 2^N corner values of a cell. Bit N-1-d of the corner index
+// selects the upper node along axis d; axes with a single node repeat it.
+template <std::size_t N>
+void gather(const std::vector<double>& data,
+            const std::array<VFPAxis, N>& axes,
+            const std::array<std::size_t, N>& strides,
+            const Positions<N>& pos,
+            Corners<N>& corners)
+{
+    std::size_t base = 0;
+    std::array<std::size_t, N> step{};
+    for (std::size_t d = 0; d < N; ++d) {
+        base += pos[d].index * strides[d];
+        step[d] = axes[d].size() > 1 ? strides[d] : 0;
+    }
+
+    for (std::size_t c = 0; c < corners.size(); ++c) {
+        std::size_t offset = base;
+        for (std::size_t d = 0; d < N; ++d) {
+            if ((c >> (N - 1 - d)) & 1) {
+                offset += step[d];
+            }
+        }
+        corners[c] = data[offset];
+    }
+}
+
+// Multilinear interpolation of the corner values, collapsing one axis at a
+// time. The derivative along an axis is the slope between the two faces
+// being collapsed; derivatives along already collapsed axes are carried
+// along with the values.
+template <std::size_t N>
+double interpolate(const Corners<N>& corners,
+                   const Positions<N>& pos,
+                   std::array<double, N>& deriv)
+{
+    Corners<N> val = corners;
+    std::array<std::array<double, N>, std::size_t{1} << N> der{};
+
+    std::size_t n = val.size();
+    for (std::size_t d = 0; d < N; ++d) {
+        const std::size_t half = n / 2;
+        const double f = pos[d].factor;
+        for (std::size_t i = 0; i < half; ++i) {
+            const double lo = val[i];
+            const double hi = val[i + half];
+            for (std::size_t e = 0; e < d; ++e) {
+                der[i][e] = (1.0 - f) * der[i][e] + f * der[i + half][e];
+            }
+            der[i][d] = (hi - lo) * pos[d].inv_dx;
+            val[i] = (1.0 - f) * lo + f * hi;
+        }
+        n = half;
+    }
+
+    deriv = der[0];
+    return val[0];
+}
+
+// Locate the point in all axes, and refresh the cached corners in the hint
+// if the point has left the cell it refers to.
+template <std::size_t N, class Hint>
+Positions<N> locate(const std::array<VFPAxis, N>& axes,
+                    const std::array<std::size_t, N>& strides,
+                    const std::vector<double>& data,
+                    const std::array<double, N>& x,
+                    Hint& hint)
+{
+    Positions<N> pos;
+    bool same_cell = hint.valid;
+    for (std::size_t d = 0; d < N; ++d) {
+        pos[d] = hint.valid ? axes[d].locate(x[d], hint.cell[d])
+                            : axes[d].locate(x[d]);
+        same_cell = same_cell && (pos[d].index == hint.cell[d]);
+    }
+
+    if (!same_cell) {
+        gather<N>(data, axes, strides, pos, hint.corners);
+        for (std::size_t d = 0; d < N; ++d) {
+            hint.cell[d] = pos[d].index;
+        }
+        hint.valid = true;
+    }
+
+    return pos;
+}
+
+// Invert a piecewise linear function y(x) which is assumed to be increasing,
+// extrapolating linearly beyond the end points.
+double invertMonotone(const std::vector<double>& x,
+                      const std::vector<double>& y,
+                      double target)
+{
+    if (x.size() < 2) {
+        return x.front();
+    }
+
+    std::size_t i = 0;
+    while (i + 2 < x.size() && y[i + 1] < target) {
+        ++i;
+    }
+
+    const double dy = y[i + 1] - y[i];
+    if (dy == 0.0) {
+        return x[i];
+    }
+
+    return x[i] + (target - y[i]) * (x[i + 1] - x[i]) / dy;
+}
+
+// Largest x within the table range for which the piecewise linear y(x)
+// equals the target.
+std::optional<double> invertLargest(const std::vector<double>& x,
+                                    const std::vector<double>& y,
+                                    double target)
+{
+    if (x.size() < 2) {
+        return (y.front() == target) ? std::optional<double>{x.front()} : std::nullopt;
+    }
+
+    for (std::size_t i = x.size() - 1; i-- > 0;) {
+        const auto [lo, hi] = std::minmax(y[i], y[i + 1]);
+        if ((target < lo) || (target > hi)) {
+            continue;
+        }
+
+        const double dy = y[i + 1] - y[i];
+        if (dy == 0.0) {
+            return x[i + 1];
+        }
+
+        return x[i] + (target - y[i]) * (x[i + 1] - x[i]) / dy;
+    }
+
+    return std::nullopt;
+}
+
+} // Anonymous namespace
+
+VFPAxis::VFPAxis(const std::vector<double>& values)
+    : m_values(values)
+{
+    if (m_values.size() < 2) {
+        return;
+    }
+
+    const std::size_t num_intervals = m_values.size() - 1;
+    const std::size_t num_buckets = 4 * num_intervals;
+    const double width = (m_values.back() - m_values.front()) / num_buckets;
+    if (!(width > 0.0)) {
+        return;
+    }
+
+    m_inv_bucket_width = 1.0 / width;
+    m_buckets.resize(num_buckets);
+
+    std::size_t i = 0;
+    for (std::size_t b = 0; b < num_buckets; ++b) {
+        const double x = m_values.front() + b * width;
+        while (i + 1 < num_intervals && m_values[i + 1] <= x) {
+            ++i;
+        }
+        m_buckets[b] = i;
+    }
+}
+
+VFPAxis::Position VFPAxis::locate(double x) const
+{
+    const std::size_t n = m_values.size();
+    if (n < 2) {
+        return {};
+    }
+
+    std::size_t i = 0;
+    if (m_buckets.empty()) {
+        const auto it = std::upper_bound(m_values.begin(), m_values.end() - 1, x);
+        i = (it == m_values.begin()) ? 0 : static_cast<std::size_t>(it - m_values.begin()) - 1;
+        i = std::min(i, n - 2);
+    } else {
+        const double b = (x - m_values.front()) * m_inv_bucket_width;
+        if (b > 0.0) {
+            const auto bucket = (b < m_buckets.size())
+                ? static_cast<std::size_t>(b) : m_buckets.size() - 1;
+            i = m_buckets[bucket];
+            while (i + 2 < n && m_values[i + 1] <= x) {
+                ++i;
+            }
+        }
+    }
+
+    return this->position(x, i);
+}
+
+VFPAxis::Position VFPAxis::locate(double x, std::size_t hint) const
+{
+    const std::size_t n = m_values.size();
+    if ((hint + 1 < n) &&
+        ((hint == 0) || (m_values[hint] <= x)) &&
+        ((hint + 2 == n) || (x < m_values[hint + 1])))
+    {
+        return this->position(x, hint);
+    }
+
+    return this->locate(x);
+}
+
+VFPAxis::Position VFPAxis::position(double x, std::size_t index) const
+{
+    const double dx = m_values[index + 1] - m_values[index];
+    if (!(dx > 0.0)) {
+        return {index, 0.0, 0.0};
+    }
+
+    return {index, (x - m_values[index]) / dx, 1.0 / dx};
+}
+
+// ---------------------------------------------------------------------------
+
+VFPProdInterpolator::VFPProdInterpolator(const VFPProdTable& table)
+    : m_table(&table)
+    , m_axes{VFPAxis{table.getTHPAxis()},
+             VFPAxis{table.getWFRAxis()},
+             VFPAxis{table.getGFRAxis()},
+             VFPAxis{table.getALQAxis()},
+             VFPAxis{table.getFloAxis()}}
+{
+    const auto [nt, nw, ng, na, nf] = table.shape();
+    m_strides = {nw * ng * na * nf, ng * na * nf, na * nf, nf, 1};
+}
+
+VFPEvaluation VFPProdInterpolator::bhp(const Point& point) const
+{
+    Hint hint;
+    return this->bhp(point, hint);
+}
+
+VFPEvaluation VFPProdInterpolator::bhp(const Point& point, Hint& hint) const
+{
+    const std::array<double, 5> x {point.thp, point.wfr, point.gfr, point.alq, point.flo};
+    const auto pos = locate<5>(m_axes, m_strides, m_table->getTable(), x, hint);
+
+    std::array<double, 5> deriv;
+    VFPEvaluation result;
+    result.value = interpolate<5>(hint.corners, pos, deriv);
+    result.dthp = deriv[0];
+    result.dwfr = deriv[1];
+    result.dgfr = deriv[2];
+    result.dalq = deriv[3];
+    result.dflo = deriv[4];
+    return result;
+}
+
+void VFPProdInterpolator::bhp(const std::vector<Point>& points,
+                              std::vector<Hint>& hints,
+                              std::vector<VFPEvaluation>& result) const
+{
+    hints.resize(points.size());
+    result.resize(points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        result[i] = this->bhp(points[i], hints[i]);
+    }
+}
+
+double VFPProdInterpolator::thp(double bhp, const Point& point) const
+{
+    const auto& axis = m_axes[0];
+    std::vector<double> bhps(axis.size());
+
+    Hint hint;
+    Point node = point;
+    for (std::size_t t = 0; t < axis.size(); ++t) {
+        node.thp = axis[t];
+        bhps[t] = this->bhp(node, hint).value;
+    }
+
+    return invertMonotone(axis.values(), bhps, bhp);
+}
+
+std::optional<double> VFPProdInterpolator::flo(double bhp, const Point& point) const
+{
+    const auto& axis = m_axes[4];
+    std::vector<double> bhps(axis.size());
+
+    Hint hint;
+    Point node = point;
+    for (std::size_t f = 0; f < axis.size(); ++f) {
+        node.flo = axis[f];
+        bhps[f] = this->bhp(node, hint).value;
+    }
+
+    return invertLargest(axis.values(), bhps, bhp);
+}
+
+// ---------------------------------------------------------------------------
+
+VFPInjInterpolator::VFPInjInterpolator(const VFPInjTable& table)
+    : m_table(&table)
+    , m_axes{VFPAxis{table.getTHPAxis()},
+             VFPAxis{table.getFloAxis()}}
+    , m_strides{table.getFloAxis().size(), 1}
+{}
+
+VFPEvaluation VFPInjInterpolator::bhp(double thp, double flo) const
+{
+    Hint hint;
+    return this->bhp(thp, flo, hint);
+}
+
+VFPEvaluation VFPInjInterpolator::bhp(double thp, double flo, Hint& hint) const
+{
+    const auto pos = locate<2>(m_axes, m_strides, m_table->getTable(), {thp, flo}, hint);
+
+    std::array<double, 2> deriv;
+    VFPEvaluation result;
+    result.value = interpolate<2>(hint.corners, pos, deriv);
+    result.dthp = deriv[0];
+    result.dflo = deriv[1];
+    return result;
+}
+
+void VFPInjInterpolator::bhp(const std::vector<double>& thp,
+                             const std::vector<double>& flo,
+                             std::vector<Hint>& hints,
+                             std::vector<VFPEvaluation>& result) const
+{
+    const std::size_t n = std::min(thp.size(), flo.size());
+    hints.resize(n);
+    result.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        result[i] = this->bhp(thp[i], flo[i], hints[i]);
+    }
+}
+
+double VFPInjInterpolator::thp(double bhp, double flo) const
+{
+    const auto& axis = m_axes[0];
+    std::vector<double> bhps(axis.size());
+
+    Hint hint;
+    for (std::size_t t = 0; t < axis.size(); ++t) {
+        bhps[t] = this->bhp(axis[t], flo, hint).value;
+    }
+
+    return invertMonotone(axis.values(), bhps, bhp);
+}
+
+std::optional<double> VFPInjInterpolator::flo(double bhp, double thp) const
+{
+    const auto& axis = m_axes[1];
+    std::vector<double> bhps(axis.size());
+
+    Hint hint;
+    for (std::size_t f = 0; f < axis.size(); ++f) {
+        bhps[f] = this->bhp(thp, axis[f], hint).value;
+    }
+
+    return invertLargest(axis.values(), bhps, bhp);
+}
+
+} // namespace Opm
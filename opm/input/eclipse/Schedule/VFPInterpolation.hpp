@@ -0,0 +1,176 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_VFP_INTERPOLATION_HPP
+#define OPM_VFP_INTERPOLATION_HPP
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace Opm {
+
+class VFPInjTable;
+class VFPProdTable;
+
+/**
+ * Sorted VFP table axis with a precomputed search accelerator.
+ *
+ * The axis range is divided into uniform buckets, each of which knows the
+ * first interval it overlaps. Locating a value is then a bucket lookup
+ * followed by a short forward scan, instead of a full bisection.
+ */
+class VFPAxis {
+public:
+    /// Interval containing a value, with the linear weight of the upper node.
+    /// Values outside the axis give a weight outside [0,1] (extrapolation).
+    struct Position {
+        std::size_t index{0};
+        double factor{0.0};
+        double inv_dx{0.0};
+    };
+
+    VFPAxis() = default;
+    explicit VFPAxis(const std::vector<double>& values);
+
+    Position locate(double x) const;
+
+    /// Like locate(), but tests the interval 'hint' first.
+    Position locate(double x, std::size_t hint) const;
+
+    std::size_t size() const { return m_values.size(); }
+    double operator[](std::size_t i) const { return m_values[i]; }
+    const std::vector<double>& values() const { return m_values; }
+
+private:
+    std::vector<double> m_values;
+    std::vector<std::size_t> m_buckets;
+    double m_inv_bucket_width{0.0};
+
+    Position position(double x, std::size_t index) const;
+};
+
+
+/// Interpolated bottom hole pressure and its partial derivatives.
+struct VFPEvaluation {
+    double value{0.0};
+    double dthp{0.0};
+    double dwfr{0.0};
+    double dgfr{0.0};
+    double dalq{0.0};
+    double dflo{0.0};
+};
+
+
+/**
+ * Multilinear interpolation in a VFPPROD table.
+ *
+ * The interpolator refers to the table it is created from, and the table
+ * must outlive it. It is immutable once constructed; all per well state
+ * is kept in caller owned Hint objects, so one interpolator can be used
+ * concurrently from several threads. Values outside the table axes are
+ * linearly extrapolated. All quantities are in SI units with a positive
+ * flow rate, i.e. as stored in the table.
+ */
+class VFPProdInterpolator {
+public:
+    struct Point {
+        double thp{0.0};
+        double wfr{0.0};
+        double gfr{0.0};
+        double alq{0.0};
+        double flo{0.0};
+    };
+
+    /// Last hypercube visited by a well, and its 32 corner values. Reusing
+    /// the hint of a well across calls avoids both the axis searches and
+    /// the table gathering as long as the well stays in the same cell.
+    /// A hint must only be used with the interpolator that filled it.
+    struct Hint {
+        std::array<std::size_t, 5> cell{};
+        std::array<double, 32> corners{};
+        bool valid{false};
+    };
+
+    explicit VFPProdInterpolator(const VFPProdTable& table);
+
+    const VFPProdTable& table() const { return *m_table; }
+
+    VFPEvaluation bhp(const Point& point) const;
+    VFPEvaluation bhp(const Point& point, Hint& hint) const;
+
+    /// Evaluate a batch of wells. The hints are resized to the number of
+    /// points if needed, and should be kept between calls.
+    void bhp(const std::vector<Point>& points,
+             std::vector<Hint>& hints,
+             std::vector<VFPEvaluation>& result) const;
+
+    /// THP giving the requested BHP at the remaining coordinates of 'point'.
+    /// Assumes BHP increases with THP, as checked when loading the table.
+    double thp(double bhp, const Point& point) const;
+
+    /// Flow rate giving the requested BHP at the remaining coordinates of
+    /// 'point'. The VFP curve is generally not monotone in the rate; the
+    /// largest rate within the table range matching the BHP is returned,
+    /// which is the stable branch of the curve. Returns nullopt if no rate
+    /// within the table range gives the requested BHP.
+    std::optional<double> flo(double bhp, const Point& point) const;
+
+private:
+    const VFPProdTable* m_table;
+    std::array<VFPAxis, 5> m_axes;
+    std::array<std::size_t, 5> m_strides;
+};
+
+
+/**
+ * Bilinear interpolation in a VFPINJ table, see VFPProdInterpolator.
+ */
+class VFPInjInterpolator {
+public:
+    struct Hint {
+        std::array<std::size_t, 2> cell{};
+        std::array<double, 4> corners{};
+        bool valid{false};
+    };
+
+    explicit VFPInjInterpolator(const VFPInjTable& table);
+
+    const VFPInjTable& table() const { return *m_table; }
+
+    /// Only the dthp and dflo members of the result are used.
+    VFPEvaluation bhp(double thp, double flo) const;
+    VFPEvaluation bhp(double thp, double flo, Hint& hint) const;
+
+    void bhp(const std::vector<double>& thp,
+             const std::vector<double>& flo,
+             std::vector<Hint>& hints,
+             std::vector<VFPEvaluation>& result) const;
+
+    double thp(double bhp, double flo) const;
+    std::optional<double> flo(double bhp, double thp) const;
+
+private:
+    const VFPInjTable* m_table;
+    std::array<VFPAxis, 2> m_axes;
+    std::array<std::size_t, 2> m_strides;
+};
+
+} // namespace Opm
+
+#endif // OPM_VFP_INTERPOLATION_HPP
@@ -148,8 +148,7 @@ std::vector<std::string> GroupOrder::names(const std::string& pattern) const
         std::copy_if(this->name_list_.begin(),
                      this->name_list_.end(),
                      std::back_inserter(gnames),
-                     [&pattern](const auto& gname)
-                     { return shmatch(pattern, gname); });
+                     ShellPattern { pattern });
     }
     else if (this->has(pattern)) {
         // Normal group name without any special characters.
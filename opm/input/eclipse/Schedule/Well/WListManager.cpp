@@ -49,6 +49,7 @@ namespace Opm {
     }
 
     WList& WListManager::newList(const std::string& name, const std::vector<std::string>& new_well_names) {
+        this->pattern_wells.clear();
         if (this->hasList(name)) {
             auto& wlist = getList(name);
             if (new_well_names.size() > 0) {
@@ -86,6 +87,8 @@ namespace Opm {
     }
 
     WList& WListManager::getList(const std::string& name) {
+        // The caller may modify the list.
+        this->pattern_wells.clear();
         return this->wlists.at(name);
     }
 
@@ -110,6 +113,7 @@ namespace Opm {
     }
 
     void WListManager::addWListWell(const std::string& wname, const std::string& wlname) {
+        this->pattern_wells.clear();
         //add well to wlist if it is not already in the well list
         auto& wlist = this->getList(wlname);
         wlist.add(wname);
@@ -132,6 +136,7 @@ namespace Opm {
     }
 
     void WListManager::delWell(const std::string& wname) {
+        this->pattern_wells.clear();
         for (auto& pair: this->wlists) {
             auto& wlist = pair.second;
             wlist.del(wname);
@@ -151,6 +156,7 @@ namespace Opm {
     }
 
     void WListManager::delWListWell(const std::string& wname, const std::string& wlname) {
+        this->pattern_wells.clear();
         //delete well from well list
         auto& wlist = this->getList(wlname);
         wlist.del(wname);
@@ -179,11 +185,16 @@ namespace Opm {
             const auto& wlist = this->getList(wlist_pattern);
             return { wlist.wells() };
         } else {
+            auto cached = this->pattern_wells.find(wlist_pattern);
+            if (cached != this->pattern_wells.end()) {
+                return cached->second;
+            }
+
             std::vector<std::string> well_set;
-            auto pattern = wlist_pattern.substr(1);
+            const ShellPattern pattern(wlist_pattern.substr(1));
             for (const auto& [name, wlist] : this->wlists) {
                 auto wlist_name = name.substr(1);
-                if (shmatch(pattern, wlist_name)) {
+                if (pattern.match(wlist_name)) {
                     const auto& well_names = wlist.wells();
                     for ( auto it = well_names.begin(); it != well_names.end(); it++ ) {
                        if (std::count(well_set.begin(), well_set.end(), *it) == 0)
@@ -191,7 +202,7 @@ namespace Opm {
                     }
                 }
             }
-            return { well_set };
+            return this->pattern_wells.emplace(wlist_pattern, std::move(well_set)).first->second;
         }
     }
 
@@ -21,6 +21,7 @@
 
 #include <cstddef>
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <string>
 #include <opm/input/eclipse/Schedule/Well/WList.hpp>
@@ -58,12 +59,20 @@ public:
         serializer(wlists);
         serializer(well_wlist_names);
         serializer(no_wlists_well);
+
+        if (!serializer.isSerializing()) {
+            this->pattern_wells.clear();
+        }
     }
 
 private:
     std::map<std::string, WList> wlists;
     std::map<std::string, std::vector<std::string>> well_wlist_names;
     std::map<std::string, std::size_t> no_wlists_well;
+
+    // Result of wells() for well list patterns.  Cleared whenever a well
+    // list may change.
+    mutable std::unordered_map<std::string, std::vector<std::string>> pattern_wells;
 };
 
 }
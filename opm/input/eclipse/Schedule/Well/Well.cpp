@@ -1969,7 +1969,7 @@ double Well::injection_rate(const SummaryState& st, Phase phase_arg) const
 bool Well::wellNameInWellNamePattern(const std::string& wellName,
                                      const std::string& wellNamePattern)
 {
-    return shmatch(wellNamePattern, wellName);
+    return ShellPattern(wellNamePattern).match(wellName);
 }
 
 Well::ProductionControls Well::productionControls(const SummaryState& st) const
@@ -192,8 +192,7 @@ Opm::WellMatcher::wells(const std::string& pattern) const
         std::copy_if(this->m_well_order->begin(),
                      this->m_well_order->end(),
                      std::back_inserter(names),
-                     [&patt](const auto& wname)
-                     { return shmatch(patt, wname); });
+                     ShellPattern { patt });
 
         names.shrink_to_fit();
         return names;
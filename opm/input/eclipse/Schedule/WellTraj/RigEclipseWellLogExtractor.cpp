@@ -36,7 +36,11 @@
 #include <external/resinsight/CommonCode/cvfStructGrid.h>
 #include <external/resinsight/LibGeometry/cvfBoundingBox.h>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <map>
+#include <vector>
 
 
 namespace external {
@@ -61,11 +65,19 @@ void RigEclipseWellLogExtractor::calculateIntersection()
 
     buildCellSearchTree();
 
-    for ( size_t wpp = 0; wpp < m_wellPathGeometry->wellPathPoints().size() - 1; ++wpp )
+    const auto& points = m_wellPathGeometry->wellPathPoints();
+    const auto numSegments = static_cast<std::int64_t>( points.size() - 1 );
+
+    // The segments are intersected with the grid independently, and the
+    // results merged in segment order afterwards.
+    std::vector<std::vector<HexIntersectionInfo>> segmentIntersections( numSegments );
+
+#pragma omp parallel for schedule(dynamic)
+    for ( std::int64_t wpp = 0; wpp < numSegments; ++wpp )
     {
-        std::vector<HexIntersectionInfo> intersections;
-        cvf::Vec3d                       p1 = m_wellPathGeometry->wellPathPoints()[wpp];
-        cvf::Vec3d                       p2 = m_wellPathGeometry->wellPathPoints()[wpp + 1];
+        auto&             intersections = segmentIntersections[wpp];
+        const cvf::Vec3d& p1 = points[wpp];
+        const cvf::Vec3d& p2 = points[wpp + 1];
 
         cvf::BoundingBox bb;
 
@@ -80,7 +92,10 @@ void RigEclipseWellLogExtractor::calculateIntersection()
             RigEclipseWellLogExtractor::hexCornersOpmToResinsight( hexCorners, globalCellIndex);
             RigHexIntersectionTools::lineHexCellIntersection( p1, p2, hexCorners, globalCellIndex, &intersections );
         }
+    }
 
+    for ( std::int64_t wpp = 0; wpp < numSegments; ++wpp )
+    {
         // Now, with all the intersections of this piece of line, we need to
         // sort them in order, and set the measured depth and corresponding cell index
 
@@ -90,7 +105,7 @@ void RigEclipseWellLogExtractor::calculateIntersection()
         double md1 = m_wellPathGeometry->measuredDepths()[wpp];
         double md2 = m_wellPathGeometry->measuredDepths()[wpp + 1];
 
-        insertIntersectionsInMap( intersections, p1, md1, p2, md2, &uniqueIntersections );
+        insertIntersectionsInMap( segmentIntersections[wpp], points[wpp], md1, points[wpp + 1], md2, &uniqueIntersections );
     }
 
     this->populateReturnArrays( uniqueIntersections );
@@ -186,14 +201,14 @@ void RigEclipseWellLogExtractor::findCellLocalXYZ( const std::array<cvf::Vec3d,
 // Convert opm to resinsight numbering of cornerpoints, see RigCellGeometryTools.cpp
 void RigEclipseWellLogExtractor::hexCornersOpmToResinsight( cvf::Vec3d hexCorners[8], size_t cellIndex ) const
 {
-    const auto[i,j,k] = m_grid.getIJK(cellIndex);
-    std::array<std::size_t, 8> opm2resinsight = {0, 1, 3, 2, 4, 5, 7, 6};
-   
+    const std::array<std::size_t, 8> opm2resinsight = {0, 1, 3, 2, 4, 5, 7, 6};
+
+    std::array<double, 8> X, Y, Z;
+    m_grid.getCellCorners(cellIndex, X, Y, Z);
+
     for (std::size_t l = 0; l < 8; l++) {
-         std::array<double, 3> cornerPointArray;
-         cornerPointArray = m_grid.getCornerPos(i,j,k,l);
-         hexCorners[opm2resinsight[l]]= cvf::Vec3d(cornerPointArray[0], cornerPointArray[1], cornerPointArray[2]);
-    } 
+         hexCorners[opm2resinsight[l]]= cvf::Vec3d(X[l], Y[l], Z[l]);
+    }
 }
 
 // Modified version of ApplicationLibCode\ReservoirDataModel\RigMainGrid.cpp
@@ -201,56 +216,41 @@ void RigEclipseWellLogExtractor::buildCellSearchTree()
 {
     if (m_cellSearchTree.isNull()) {
 
-        auto nx = m_grid.getNX();
-        auto ny = m_grid.getNY();
-        auto nz = m_grid.getNZ();
+        const auto cellCount = static_cast<std::int64_t>(m_grid.getCartesianSize());
+
+        // Inactive cells are included, connections in them are reported
+        // with a warning by the caller.
+        std::vector<cvf::BoundingBox> boundingBoxes(cellCount);
+
+#pragma omp parallel for schedule(static)
+        for (std::int64_t cIdx = 0; cIdx < cellCount; ++cIdx) {
+            std::array<double, 8> X, Y, Z;
+            m_grid.getCellCorners(cIdx, X, Y, Z);
+
+            auto& cellBB = boundingBoxes[cIdx];
+            for (std::size_t l = 0; l < 8; l++) {
+                cellBB.add(cvf::Vec3d(X[l], Y[l], Z[l]));
+            }
+        }
 
-        size_t cellCount = nx * ny * nz;
         std::vector<size_t>           cellIndicesForBoundingBoxes;
         std::vector<cvf::BoundingBox> cellBoundingBoxes;
 
-// #pragma omp parallel
-//         {
-            size_t threadCellCount = cellCount;
-
-            std::vector<size_t>           threadIndicesForBoundingBoxes;
-            std::vector<cvf::BoundingBox> threadBoundingBoxes;
-
-            threadIndicesForBoundingBoxes.reserve( threadCellCount );
-            threadBoundingBoxes.reserve( threadCellCount );
-
-            std::array<double, 3> cornerPointArray;
-            cvf::Vec3d cornerPoint;
-
-// #pragma omp for
-            for (int cIdx = 0; cIdx < (int)cellCount; ++cIdx) {
-                const auto[i,j,k] = m_grid.getIJK(cIdx);
-                cvf::BoundingBox cellBB;
-                for (std::size_t l = 0; l < 8; l++) {
-                     cornerPointArray = m_grid.getCornerPos(i,j,k,l);
-                     cornerPoint = cvf::Vec3d(cornerPointArray[0], cornerPointArray[1], cornerPointArray[2]);
-                     cellBB.add(cornerPoint);
-                }
-
-                if (cellBB.isValid()) {
-                    threadIndicesForBoundingBoxes.emplace_back(cIdx);
-                    threadBoundingBoxes.emplace_back(cellBB);
-                }
+        cellIndicesForBoundingBoxes.reserve(cellCount);
+        cellBoundingBoxes.reserve(cellCount);
+
+        for (std::int64_t cIdx = 0; cIdx < cellCount; ++cIdx) {
+            if (boundingBoxes[cIdx].isValid()) {
+                cellIndicesForBoundingBoxes.push_back(cIdx);
+                cellBoundingBoxes.push_back(boundingBoxes[cIdx]);
             }
+        }
+
+        boundingBoxes.clear();
+        boundingBoxes.shrink_to_fit();
 
-            threadIndicesForBoundingBoxes.shrink_to_fit();
-            threadBoundingBoxes.shrink_to_fit();
-// #pragma omp critical
-//          {
-             cellIndicesForBoundingBoxes.insert( cellIndicesForBoundingBoxes.end(),
-                                                 threadIndicesForBoundingBoxes.begin(),
-                                                 threadIndicesForBoundingBoxes.end() );
-
-             cellBoundingBoxes.insert( cellBoundingBoxes.end(), threadBoundingBoxes.begin(), threadBoundingBoxes.end() );
-        //  }
-    // } #pragma omp parallel
-         m_cellSearchTree = new cvf::BoundingBoxTree;
-         m_cellSearchTree->buildTreeFromBoundingBoxes( cellBoundingBoxes, &cellIndicesForBoundingBoxes );
+        m_cellSearchTree = new cvf::BoundingBoxTree;
+        m_cellSearchTree->buildTreeFromBoundingBoxes( cellBoundingBoxes, &cellIndicesForBoundingBoxes );
     }
 }
 
@@ -263,7 +263,7 @@ void RigEclipseWellLogExtractor::findIntersectingCells( const cvf::BoundingBox&
 }
 
 // Modified version of ApplicationLibCode\ReservoirDataModel\RigEclipseWellLogExtractor.cpp 
-std::vector<size_t> RigEclipseWellLogExtractor::findCloseCellIndices( const cvf::BoundingBox& bb )
+std::vector<size_t> RigEclipseWellLogExtractor::findCloseCellIndices( const cvf::BoundingBox& bb ) const
 {
     std::vector<size_t> closeCells;
     this->findIntersectingCells( bb, &closeCells );
@@ -52,7 +52,7 @@ public:
     cvf::ref<cvf::BoundingBoxTree> getCellSearchTree();
 private:
     void                calculateIntersection();
-    std::vector<size_t> findCloseCellIndices( const cvf::BoundingBox& bb );
+    std::vector<size_t> findCloseCellIndices( const cvf::BoundingBox& bb ) const;
     cvf::Vec3d
         calculateLengthInCell( size_t cellIndex, const cvf::Vec3d& startPoint, const cvf::Vec3d& endPoint ) const override;
 
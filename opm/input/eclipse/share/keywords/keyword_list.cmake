@@ -1124,6 +1124,7 @@ set( keywords
      900_OPM/B/BIOFPARA
      900_OPM/B/BIOTCOEF
      900_OPM/B/BLOCK_PROBE900
+     900_OPM/C/CO2SOLTB
      900_OPM/C/CO2STOR
      900_OPM/C/COMPTRAJ
      900_OPM/C/CONNECTION_PROBE_OPM
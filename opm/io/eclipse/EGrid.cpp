@@ -21,9 +21,11 @@
 #include <opm/io/eclipse/EclUtil.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
+#include <opm/common/utility/numeric/calculateCellVol.hpp>
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
@@ -361,33 +363,29 @@ void EGrid::mapaxes_init()
     unit_y[1] *= norm_y;
 }
 
-void EGrid::getCellCorners(const std::array<int, 3>& ijk,
-                           std::array<double, 8>& X,
-                           std::array<double, 8>& Y,
-                           std::array<double, 8>& Z)
+void EGrid::cellCorners(const std::array<int, 3>& ijk,
+                        std::array<double, 8>& X,
+                        std::array<double, 8>& Y,
+                        std::array<double, 8>& Z) const
 {
-    if (coord_array.empty())
-        load_grid_data();
+    const int res_shift = res.at(ijk[2])*(nijk[0]+1)*(nijk[1]+1)*6;
 
-    std::vector<int> zind;
-    std::vector<int> pind;
-
-    int res_shift = res.at(ijk[2])*(nijk[0]+1)*(nijk[1]+1)*6;
-    
-   // calculate indices for grid pillars in COORD arrray
-    pind.push_back(res_shift + ijk[1]*(nijk[0]+1)*6 + ijk[0]*6);
-    pind.push_back(pind[0] + 6);
-    pind.push_back(pind[0] + (nijk[0]+1)*6);
-    pind.push_back(pind[2] + 6);
+    // calculate indices for grid pillars in COORD arrray
+    std::array<int, 4> pind;
+    pind[0] = res_shift + ijk[1]*(nijk[0]+1)*6 + ijk[0]*6;
+    pind[1] = pind[0] + 6;
+    pind[2] = pind[0] + (nijk[0]+1)*6;
+    pind[3] = pind[2] + 6;
 
     // get depths from zcorn array in ZCORN array
-    zind.push_back(ijk[2]*nijk[0]*nijk[1]*8 + ijk[1]*nijk[0]*4 + ijk[0]*2);
-    zind.push_back(zind[0] + 1);
-    zind.push_back(zind[0] + nijk[0]*2);
-    zind.push_back(zind[2] + 1);
+    std::array<int, 8> zind;
+    zind[0] = ijk[2]*nijk[0]*nijk[1]*8 + ijk[1]*nijk[0]*4 + ijk[0]*2;
+    zind[1] = zind[0] + 1;
+    zind[2] = zind[0] + nijk[0]*2;
+    zind[3] = zind[2] + 1;
 
     for (int n = 0; n < 4; n++)
-        zind.push_back(zind[n] + nijk[0]*nijk[1]*4);
+        zind[n+4] = zind[n] + nijk[0]*nijk[1]*4;
 
     for (int n = 0; n < 8; n++)
         Z[n] = zcorn_array[zind[n]];
@@ -428,6 +426,18 @@ void EGrid::getCellCorners(const std::array<int, 3>& ijk,
 }
 
 
+void EGrid::getCellCorners(const std::array<int, 3>& ijk,
+                           std::array<double, 8>& X,
+                           std::array<double, 8>& Y,
+                           std::array<double, 8>& Z)
+{
+    if (coord_array.empty())
+        load_grid_data();
+
+    this->cellCorners(ijk, X, Y, Z);
+}
+
+
 void EGrid::getCellCorners(int globindex, std::array<double, 8>& X,
                            std::array<double, 8>& Y, std::array<double, 8>& Z)
 {
@@ -435,6 +445,139 @@ void EGrid::getCellCorners(int globindex, std::array<double, 8>& X,
 }
 
 
+void EGrid::checkGlobalIndices(const std::vector<int>& globindex) const
+{
+    const int nTot = nijk[0] * nijk[1] * nijk[2];
+    auto invalid = std::find_if(globindex.begin(), globindex.end(),
+                                [nTot](const int ind) { return (ind < 0) || (ind >= nTot); });
+
+    if (invalid != globindex.end()) {
+        OPM_THROW(std::invalid_argument,
+                  fmt::format("global index {} out of range", *invalid));
+    }
+}
+
+
+void EGrid::getCellCorners(const std::vector<int>& globindex,
+                           std::vector<std::array<double, 8>>& X,
+                           std::vector<std::array<double, 8>>& Y,
+                           std::vector<std::array<double, 8>>& Z)
+{
+    checkGlobalIndices(globindex);
+
+    if (coord_array.empty())
+        load_grid_data();
+
+    X.resize(globindex.size());
+    Y.resize(globindex.size());
+    Z.resize(globindex.size());
+
+    #pragma omp parallel for schedule(static)
+    for (std::int64_t n = 0; n < static_cast<std::int64_t>(globindex.size()); n++)
+        this->cellCorners(ijk_from_global_index(globindex[n]), X[n], Y[n], Z[n]);
+}
+
+
+void EGrid::getCellVolumes(const std::vector<int>& globindex, std::vector<double>& volume)
+{
+    checkGlobalIndices(globindex);
+
+    if (coord_array.empty())
+        load_grid_data();
+
+    volume.resize(globindex.size());
+
+    #pragma omp parallel for schedule(static)
+    for (std::int64_t n = 0; n < static_cast<std::int64_t>(globindex.size()); n++) {
+        std::array<double, 8> X;
+        std::array<double, 8> Y;
+        std::array<double, 8> Z;
+
+        this->cellCorners(ijk_from_global_index(globindex[n]), X, Y, Z);
+        volume[n] = calculateCellVol(X, Y, Z);
+    }
+}
+
+
+void EGrid::getCellCenters(const std::vector<int>& globindex, std::vector<std::array<double, 3>>& center)
+{
+    checkGlobalIndices(globindex);
+
+    if (coord_array.empty())
+        load_grid_data();
+
+    center.resize(globindex.size());
+
+    #pragma omp parallel for schedule(static)
+    for (std::int64_t n = 0; n < static_cast<std::int64_t>(globindex.size()); n++) {
+        std::array<double, 8> X;
+        std::array<double, 8> Y;
+        std::array<double, 8> Z;
+
+        this->cellCorners(ijk_from_global_index(globindex[n]), X, Y, Z);
+
+        center[n] = { std::accumulate(X.begin(), X.end(), 0.0) / 8.0,
+                      std::accumulate(Y.begin(), Y.end(), 0.0) / 8.0,
+                      std::accumulate(Z.begin(), Z.end(), 0.0) / 8.0 };
+    }
+}
+
+
+void EGrid::getCellDepths(const std::vector<int>& globindex, std::vector<double>& depth)
+{
+    checkGlobalIndices(globindex);
+
+    if (zcorn_array.empty())
+        load_grid_data();
+
+    depth.resize(globindex.size());
+
+    const int nx = nijk[0];
+    const int ny = nijk[1];
+
+    // Only ZCORN is needed, the cell depth being the mean of its corner depths.
+    #pragma omp parallel for schedule(static)
+    for (std::int64_t n = 0; n < static_cast<std::int64_t>(globindex.size()); n++) {
+        const int glob = globindex[n];
+        const int k = glob / (nx*ny);
+        const int j = (glob % (nx*ny)) / nx;
+        const int i = glob % nx;
+
+        const auto* top = &zcorn_array[k*nx*ny*8 + j*nx*4 + i*2];
+        const auto* bottom = top + nx*ny*4;
+
+        double sum = 0.0;
+        for (const auto* z : { top, bottom })
+            sum += z[0] + z[1] + z[2*nx] + z[2*nx + 1];
+
+        depth[n] = sum / 8.0;
+    }
+}
+
+
+std::vector<int> EGrid::layerCells(int k1, int k2, bool activeOnly) const
+{
+    if ((k1 < 0) || (k2 >= nijk[2]) || (k1 > k2)) {
+        throw std::invalid_argument(fmt::format("invalid layer range [{},{}]. Valid range [0,{}]",
+                                                k1, k2, nijk[2] - 1));
+    }
+
+    const int nLayer = nijk[0] * nijk[1];
+    std::vector<int> cells;
+
+    if (activeOnly) {
+        for (int glob = k1 * nLayer; glob < (k2 + 1) * nLayer; glob++)
+            if (act_index[glob] > -1)
+                cells.push_back(glob);
+    } else {
+        cells.resize((k2 - k1 + 1) * nLayer);
+        std::iota(cells.begin(), cells.end(), k1 * nLayer);
+    }
+
+    return cells;
+}
+
+
 std::vector<std::array<float, 3>> EGrid::getXYZ_layer(int layer, const std::array<int, 4>& box, bool bottom)
 {
    // layer is layer index, zero based. The box array is i and j range (i1,i2,j1,j2), also zero based
@@ -599,22 +742,21 @@ std::vector<float> EGrid::  get_zcorn_from_disk(int layer, bool bottom)
 
 
 void EGrid::getCellCorners(const std::array<int, 3>& ijk, const std::vector<float>& zcorn_layer,
-                           std::array<double,4>& X, std::array<double,4>& Y, std::array<double,4>& Z)
+                           std::array<double,4>& X, std::array<double,4>& Y, std::array<double,4>& Z) const
 {
-    std::vector<int> zind;
-    std::vector<int> pind;
-
    // calculate indices for grid pillars in COORD arrray
-    pind.push_back(ijk[1]*(nijk[0]+1)*6 + ijk[0]*6);
-    pind.push_back(pind[0] + 6);
-    pind.push_back(pind[0] + (nijk[0]+1)*6);
-    pind.push_back(pind[2] + 6);
+    std::array<int, 4> pind;
+    pind[0] = ijk[1]*(nijk[0]+1)*6 + ijk[0]*6;
+    pind[1] = pind[0] + 6;
+    pind[2] = pind[0] + (nijk[0]+1)*6;
+    pind[3] = pind[2] + 6;
 
     // get depths from zcorn array in ZCORN array
-    zind.push_back(ijk[2]*nijk[0]*nijk[1]*8 + ijk[1]*nijk[0]*4 + ijk[0]*2);
-    zind.push_back(zind[0] + 1);
-    zind.push_back(zind[0] + nijk[0]*2);
-    zind.push_back(zind[2] + 1);
+    std::array<int, 4> zind;
+    zind[0] = ijk[2]*nijk[0]*nijk[1]*8 + ijk[1]*nijk[0]*4 + ijk[0]*2;
+    zind[1] = zind[0] + 1;
+    zind[2] = zind[0] + nijk[0]*2;
+    zind[3] = zind[2] + 1;
 
     for (int n = 0; n< 4; n++)
         Z[n] = zcorn_layer[zind[n]];
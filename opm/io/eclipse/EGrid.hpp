@@ -45,6 +45,21 @@ public:
     void getCellCorners(int globindex, std::array<double, 8>& X, std::array<double, 8>& Y, std::array<double, 8>& Z);
     void getCellCorners(const std::array<int, 3>& ijk, std::array<double, 8>& X, std::array<double, 8>& Y, std::array<double, 8>& Z);
 
+    // Bulk versions of the cell geometry for a set of cells given by global
+    // index, evaluated in parallel.  The output vectors are resized to the
+    // number of cells and may be reused between calls.
+    void getCellCorners(const std::vector<int>& globindex,
+                        std::vector<std::array<double, 8>>& X,
+                        std::vector<std::array<double, 8>>& Y,
+                        std::vector<std::array<double, 8>>& Z);
+    void getCellVolumes(const std::vector<int>& globindex, std::vector<double>& volume);
+    void getCellCenters(const std::vector<int>& globindex, std::vector<std::array<double, 3>>& center);
+    void getCellDepths(const std::vector<int>& globindex, std::vector<double>& depth);
+
+    // Global indices of the cells in layers k1 to k2 (zero based, inclusive),
+    // optionally restricted to the active cells.
+    std::vector<int> layerCells(int k1, int k2, bool activeOnly = false) const;
+
     std::vector<std::array<float, 3>> getXYZ_layer(int layer, bool bottom=false);
     std::vector<std::array<float, 3>> getXYZ_layer(int layer, const std::array<int, 4>& box, bool bottom=false);
 
@@ -118,7 +133,13 @@ private:
     std::vector<float> get_zcorn_from_disk(int layer, bool bottom);
 
     void getCellCorners(const std::array<int, 3>& ijk, const std::vector<float>& zcorn_layer,
-                        std::array<double, 4>& X, std::array<double, 4>& Y, std::array<double, 4>& Z);
+                        std::array<double, 4>& X, std::array<double, 4>& Y, std::array<double, 4>& Z) const;
+
+    // Requires the grid data to be loaded, and may be called concurrently.
+    void cellCorners(const std::array<int, 3>& ijk, std::array<double, 8>& X,
+                     std::array<double, 8>& Y, std::array<double, 8>& Z) const;
+
+    void checkGlobalIndices(const std::vector<int>& globindex) const;
 
     void mapaxes_init();
     
@@ -91,6 +91,26 @@ void ERst::loadReportStepNumber(int number)
 }
 
 
+void ERst::unloadReportStepNumber(int number)
+{
+    if (!hasReportStepNumber(number)) {
+        OPM_THROW(std::invalid_argument,
+                  fmt::format("Trying to unload non existing report step number {}", number));
+    }
+
+    std::vector<int> arrayIndexList;
+    arrayIndexList.reserve(arrIndexRange.at(number).second - arrIndexRange.at(number).first);
+
+    for (int i = arrIndexRange.at(number).first; i < arrIndexRange.at(number).second; i++) {
+        arrayIndexList.push_back(i);
+    }
+
+    clearData(arrayIndexList);
+
+    reportLoaded[number] = false;
+}
+
+
 std::vector<EclFile::EclEntry> ERst::listOfRstArrays(int reportStepNumber)
 {
     return this->listOfRstArrays(reportStepNumber, "global");
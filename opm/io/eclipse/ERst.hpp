@@ -45,6 +45,10 @@ public:
 
     void loadReportStepNumber(int number);
 
+    // Release the data of all arrays in report step 'number'.  The arrays
+    // are loaded again on demand.
+    void unloadReportStepNumber(int number);
+
     template <typename T>
     const std::vector<T>& getRestartData(const std::string& name, int reportStepNumber)
     {
@@ -1409,7 +1409,7 @@ std::vector<std::string> ESmry::keywordList(const std::string& pattern) const
     std::vector<std::string> list;
 
     std::copy_if(keyword.begin(), keyword.end(), std::back_inserter(list),
-                 [&pattern](const auto& key) { return shmatch(pattern, key); });
+                 ShellPattern { pattern });
     return list;
 }
 
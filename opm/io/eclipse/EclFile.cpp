@@ -17,13 +17,18 @@
    */
 
 #include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <cstddef>
+#include <filesystem>
 #include <fstream>
+#include <limits>
+#include <optional>
 #include <string>
 #include <numeric>
 #include <cmath>
@@ -32,7 +37,25 @@
 
 namespace Opm { namespace EclIO {
 
-void EclFile::load(bool preload) {
+void EclFile::addArray(const std::string& name, eclArrType type, std::int64_t num,
+                       int sizeOfElement, std::uint64_t pos)
+{
+    const auto n = array_name.size();
+
+    array_size.push_back(num);
+    array_type.push_back(type);
+    array_name.push_back(name);
+    array_element_size.push_back(sizeOfElement);
+
+    array_index[array_name[n]] = n;
+
+    ifStreamPos.push_back(pos);
+
+    arrayLoaded.push_back(false);
+}
+
+
+void EclFile::load(bool preload, std::optional<std::uint64_t> scanFrom) {
     std::fstream fileH;
 
     if (formatted) {
@@ -44,7 +67,15 @@ void EclFile::load(bool preload) {
     if (!fileH)
         throw std::runtime_error(fmt::format("Can not open EclFile: {}", this->inputFilename));
 
-    int n = 0;
+    if (scanFrom.has_value()) {
+        fileH.seekg(static_cast<std::streamoff>(*scanFrom), std::ios_base::beg);
+    }
+    else if (!formatted) {
+        const auto indexed = this->loadIndex(fileH);
+        fileH.clear();
+        fileH.seekg(static_cast<std::streamoff>(indexed), std::ios_base::beg);
+    }
+
     while (!isEOF(&fileH)) {
         std::string arrName(8,' ');
         eclArrType arrType;
@@ -62,17 +93,8 @@ void EclFile::load(bool preload) {
                 fmt::format("Unable to read array header from {}: {} \nPlease check if the file is corrupt!", this->inputFilename, e.what()));
         }
 
-        array_size.push_back(num);
-        array_type.push_back(arrType);
-        array_name.push_back(trimr(arrName));
-        array_element_size.push_back(sizeOfElement);
-
-        array_index[array_name[n]] = n;
-
         std::uint64_t pos = fileH.tellg();
-        ifStreamPos.push_back(pos);
-
-        arrayLoaded.push_back(false);
+        this->addArray(trimr(arrName), arrType, num, sizeOfElement, pos);
 
         if (num > 0){
             if (formatted) {
@@ -83,8 +105,6 @@ void EclFile::load(bool preload) {
                 fileH.seekg(static_cast<std::streamoff>(sizeOfNextArray), std::ios_base::cur);
             }
         }
-
-        n++;
     };
 
     fileH.seekg(0, std::ios_base::end);
@@ -117,6 +137,12 @@ EclFile::EclFile(const std::string& filename, bool preload) :
 
 void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
 {
+    // Loaded arrays are never reread.  Their storage may be referenced by
+    // callers, e.g., as NumPy views in the Python bindings.
+    if (arrayLoaded[arrIndex]) {
+        return;
+    }
+
     fileH.seekg (ifStreamPos[arrIndex], fileH.beg);
 
     switch (array_type[arrIndex]) {
@@ -218,7 +244,7 @@ void EclFile::loadData(const std::string& name)
 
         for (unsigned int arrIndex = 0; arrIndex < array_name.size(); arrIndex++) {
 
-            if (array_name[arrIndex] == name) {
+            if ((array_name[arrIndex] == name) && !arrayLoaded[arrIndex]) {
 
                 inFile.seekg(ifStreamPos[arrIndex]);
 
@@ -263,6 +289,10 @@ void EclFile::loadData(const std::vector<int>& arrIndex)
 
         for (int ind : arrIndex) {
 
+            if (arrayLoaded[ind]) {
+                continue;
+            }
+
             inFile.seekg(ifStreamPos[ind]);
 
             std::size_t disk_size = sizeOnDiskFormatted(array_size[ind],
@@ -293,8 +323,26 @@ void EclFile::loadData(const std::vector<int>& arrIndex)
 }
 
 
+void EclFile::clearData(const std::vector<int>& arrIndex)
+{
+    for (int ind : arrIndex) {
+        inte_array.erase(ind);
+        real_array.erase(ind);
+        doub_array.erase(ind);
+        logi_array.erase(ind);
+        char_array.erase(ind);
+
+        arrayLoaded[ind] = false;
+    }
+}
+
+
 void EclFile::loadData(int arrIndex)
 {
+    if (arrayLoaded[arrIndex]) {
+        return;
+    }
+
     if (formatted) {
 
         std::ifstream inFile(inputFilename);
@@ -648,4 +696,295 @@ EclFile::getImpl(int, eclArrType, const std::unordered_map<int,std::vector<int>>
 template const std::vector<std::string>&
 EclFile::getImpl(int, eclArrType, const std::unordered_map<int,std::vector<std::string>>&, const std::string&);
 
+
+namespace {
+
+// The index of a binary file is itself a binary ECL file made of blocks.
+// Each block lists the arrays in a contiguous part of the indexed file, in
+// the arrays NAME, TYPE, SIZE, ELEMSIZE and POSITION, followed by the size
+// (FILESIZE) and modification time (MTIME) of the indexed file at the time
+// the block was written.  A block is appended each time the indexed file
+// grows, so the index need not be rewritten.
+const std::array<std::string, 7> indexBlockArrays {
+    "NAME", "TYPE", "SIZE", "ELEMSIZE", "POSITION", "FILESIZE", "MTIME"
+};
+
+struct IndexEntries
+{
+    std::vector<std::string> names{};
+    std::vector<int> types{};
+    std::vector<double> sizes{};
+    std::vector<int> elementSizes{};
+    std::vector<double> positions{};
+
+    // Size and modification time of the indexed file according to the last
+    // block of the index.
+    std::uint64_t fileSize{0};
+    double modificationTime{0.0};
+
+    // Number of leading entries of arrays whose header begins before
+    // 'limit'.  An array whose header starts at 'limit' has its data
+    // strictly past 'limit'.
+    std::size_t countBefore(const std::uint64_t limit) const
+    {
+        const auto end = std::find_if(this->positions.begin(), this->positions.end(),
+                                      [limit](const double pos)
+                                      { return static_cast<std::uint64_t>(pos) > limit; });
+
+        return std::distance(this->positions.begin(), end);
+    }
+
+    void resize(const std::size_t n)
+    {
+        this->names.resize(n);
+        this->types.resize(n);
+        this->sizes.resize(n);
+        this->elementSizes.resize(n);
+        this->positions.resize(n);
+    }
+};
+
+template <typename T>
+void appendTo(std::vector<T>& to, const std::vector<T>& from)
+{
+    to.insert(to.end(), from.begin(), from.end());
+}
+
+double modificationTime(const std::string& filename)
+{
+    return static_cast<double>(std::filesystem::last_write_time(filename)
+                               .time_since_epoch().count());
+}
+
+std::optional<IndexEntries> readIndex(const std::string& indexFile)
+{
+    if (!fileExists(indexFile))
+        return std::nullopt;
+
+    try {
+        EclFile index(indexFile, EclFile::Formatted{false});
+
+        const auto& names = index.arrayNames();
+        const auto blockSize = indexBlockArrays.size();
+        if (names.empty() || (names.size() % blockSize != 0))
+            return std::nullopt;
+
+        IndexEntries entries;
+        for (std::size_t first = 0; first < names.size(); first += blockSize) {
+            if (! std::equal(indexBlockArrays.begin(), indexBlockArrays.end(), names.begin() + first))
+                return std::nullopt;
+
+            const auto ix = static_cast<int>(first);
+            appendTo(entries.names, index.get<std::string>(ix + 0));
+            appendTo(entries.types, index.get<int>(ix + 1));
+            appendTo(entries.sizes, index.get<double>(ix + 2));
+            appendTo(entries.elementSizes, index.get<int>(ix + 3));
+            appendTo(entries.positions, index.get<double>(ix + 4));
+            entries.fileSize = static_cast<std::uint64_t>(index.get<double>(ix + 5).at(0));
+            entries.modificationTime = index.get<double>(ix + 6).at(0);
+        }
+
+        const auto n = entries.names.size();
+        if ((entries.types.size() != n) || (entries.sizes.size() != n) ||
+            (entries.elementSizes.size() != n) || (entries.positions.size() != n))
+        {
+            return std::nullopt;
+        }
+
+        return entries;
+    }
+    catch (const std::exception&) {
+        return std::nullopt;
+    }
+}
+
+void writeIndexBlock(EclOutput& output, const IndexEntries& block)
+{
+    output.write(indexBlockArrays[0], block.names);
+    output.write(indexBlockArrays[1], block.types);
+    output.write(indexBlockArrays[2], block.sizes);
+    output.write(indexBlockArrays[3], block.elementSizes);
+    output.write(indexBlockArrays[4], block.positions);
+    output.write(indexBlockArrays[5], std::vector<double> { static_cast<double>(block.fileSize) });
+    output.write(indexBlockArrays[6], std::vector<double> { block.modificationTime });
+}
+
+// Whether the binary array header which precedes data position 'pos' in
+// 'fileH' is that of an array 'name' with 'size' elements.
+bool hasArrayHeader(std::fstream& fileH, const std::string& name,
+                    const std::int64_t size, const std::uint64_t pos)
+{
+    // Record markers, name, element count and type.
+    constexpr std::uint64_t headerSize = 4 + 8 + 4 + 4 + 4;
+    if (pos < headerSize)
+        return false;
+
+    std::array<char, headerSize> header{};
+    fileH.clear();
+    fileH.seekg(static_cast<std::streamoff>(pos - headerSize), std::ios_base::beg);
+    fileH.read(header.data(), header.size());
+    if (!fileH)
+        return false;
+
+    int head, count, tail;
+    std::memcpy(&head, header.data(), sizeof head);
+    std::memcpy(&count, header.data() + 12, sizeof count);
+    std::memcpy(&tail, header.data() + 20, sizeof tail);
+
+    // Arrays of 2^31 or more elements have a two-part header whose second
+    // part holds the element count modulo 2^31.
+    return (flipEndianInt(head) == 16) && (flipEndianInt(tail) == 16)
+        && (trimr(std::string(header.data() + 4, 8)) == name)
+        && ((size > std::numeric_limits<int>::max()) || (flipEndianInt(count) == size));
+}
+
+// Compare the first, middle and last of the first 'count' index entries to
+// the array headers in the indexed file.
+bool headersMatch(std::fstream& fileH, const IndexEntries& entries, const std::size_t count)
+{
+    if (count == 0)
+        return true;
+
+    for (const auto i : { std::size_t{0}, count / 2, count - 1 }) {
+        if (! hasArrayHeader(fileH, entries.names[i],
+                             static_cast<std::int64_t>(entries.sizes[i]),
+                             static_cast<std::uint64_t>(entries.positions[i])))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Whether the size and modification time recorded in the index are those
+// of 'filename'.
+bool describesFile(const IndexEntries& entries, const std::string& filename)
+{
+    return (entries.fileSize == std::filesystem::file_size(filename))
+        && (entries.modificationTime == modificationTime(filename));
+}
+
+} // Anonymous namespace
+
+
+std::uint64_t EclFile::loadIndex(std::fstream& fileH)
+{
+    // Returns the number of leading bytes of the file whose array headers
+    // were loaded from the index, or zero if the index was not used.
+    try {
+        const auto entries = readIndex(indexFileName(this->inputFilename));
+        if (! entries.has_value() || ! describesFile(*entries, this->inputFilename))
+            return 0;
+
+        const auto count = entries->countBefore(entries->fileSize);
+        if (! headersMatch(fileH, *entries, count))
+            return 0;
+
+        for (std::size_t i = 0; i < count; ++i) {
+            this->addArray(entries->names[i], static_cast<eclArrType>(entries->types[i]),
+                           static_cast<std::int64_t>(entries->sizes[i]), entries->elementSizes[i],
+                           static_cast<std::uint64_t>(entries->positions[i]));
+        }
+
+        return entries->fileSize;
+    }
+    catch (const std::exception&) {
+        // Unreadable index.  Fall back to reading the file's own headers.
+        return 0;
+    }
+}
+
+
+
+EclFile::EclFile(const std::string& filename, ScanFrom scanFrom) :
+    formatted(false),
+    inputFilename(filename)
+{
+    this->load(false, scanFrom.value);
+}
+
+
+std::string EclFile::indexFileName(const std::string& filename)
+{
+    return filename + ".OPMIDX";
+}
+
+
+bool EclFile::hasValidIndex(const std::string& filename)
+{
+    if (!fileExists(filename))
+        return false;
+
+    try {
+        const auto entries = readIndex(indexFileName(filename));
+        if (! entries.has_value() || ! describesFile(*entries, filename))
+            return false;
+
+        std::fstream fileH(filename, std::ios::in | std::ios::binary);
+        return headersMatch(fileH, *entries, entries->countBefore(entries->fileSize));
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+}
+
+
+void EclFile::writeIndex(const std::string& filename, std::uint64_t knownSize)
+{
+    const auto indexFile = indexFileName(filename);
+
+    auto entries = (knownSize > 0) ? readIndex(indexFile) : std::nullopt;
+    if (entries.has_value() && (entries->fileSize < knownSize))
+        entries.reset();
+
+    // Only the array headers past the part of the file described by the
+    // existing index are read.
+    const auto scanFrom = entries.has_value() ? knownSize : std::uint64_t{0};
+    const EclFile file(filename, ScanFrom{scanFrom});
+
+    IndexEntries block;
+    block.fileSize = std::filesystem::file_size(filename);
+    block.modificationTime = modificationTime(filename);
+    for (std::size_t i = 0; i < file.array_name.size(); ++i) {
+        block.names.push_back(file.array_name[i]);
+        block.types.push_back(static_cast<int>(file.array_type[i]));
+        block.sizes.push_back(static_cast<double>(file.array_size[i]));
+        block.elementSizes.push_back(file.array_element_size[i]);
+        block.positions.push_back(static_cast<double>(file.ifStreamPos[i]));
+    }
+
+    if (entries.has_value() && (entries->fileSize == knownSize)) {
+        // The file has only grown since the index was written.  Describe
+        // the new arrays in a new block at the end of the index.
+        EclOutput output(indexFile, false, std::ios::app);
+        writeIndexBlock(output, block);
+        return;
+    }
+
+    if (entries.has_value()) {
+        // Part of the file was overwritten.  Keep the entries before the
+        // overwritten part and rewrite the index as a single block.
+        entries->resize(entries->countBefore(knownSize));
+        appendTo(entries->names, block.names);
+        appendTo(entries->types, block.types);
+        appendTo(entries->sizes, block.sizes);
+        appendTo(entries->elementSizes, block.elementSizes);
+        appendTo(entries->positions, block.positions);
+        entries->fileSize = block.fileSize;
+        entries->modificationTime = block.modificationTime;
+        block = std::move(*entries);
+    }
+
+    // Written to a temporary file first, so readers never see a partially
+    // written index.
+    const auto tmpFile = indexFile + ".tmp";
+    {
+        EclOutput output(tmpFile, false);
+        writeIndexBlock(output, block);
+    }
+
+    std::filesystem::rename(tmpFile, indexFile);
+}
+
 }} // namespace Opm::EclIO
@@ -21,8 +21,10 @@
 
 #include <opm/io/eclipse/EclIOdata.hpp>
 
+#include <cstdint>
 #include <ios>
 #include <map>
+#include <optional>
 #include <string>
 #include <stdexcept>
 #include <tuple>
@@ -59,6 +61,8 @@ public:
       std::fill(arrayLoaded.begin(), arrayLoaded.end(), false);
     }
 
+    void clearData(const std::vector<int>& arrIndex);  // release data of arrays with indices in arrIndex
+
     using EclEntry = std::tuple<std::string, eclArrType, std::int64_t>;
     std::vector<EclEntry> getList() const;
 
@@ -77,6 +81,27 @@ public:
     std::size_t size() const;
     bool is_ix() const;
 
+    // Optional index of a binary file, listing the names, types, sizes and
+    // positions of all its arrays.  When an up to date index exists, the
+    // constructor reads it instead of visiting every array header in the
+    // file, which matters for large unified restart files.  The index is
+    // up to date if it records the current size and modification time of
+    // the file, and if a sample of the array headers it lists are found at
+    // the recorded positions.
+    static std::string indexFileName(const std::string& filename);
+
+    // Whether 'filename' has an index describing its current contents.
+    static bool hasValidIndex(const std::string& filename);
+
+    // Create or update the index of binary file 'filename'.  The first
+    // 'knownSize' bytes of the file must be unchanged since its existing
+    // index was written, e.g., the size of a restart file before a report
+    // step was appended.  Only array headers past that point are read from
+    // the file.  If the index ends at 'knownSize', the new arrays are
+    // appended to it, otherwise it is rewritten.  A 'knownSize' of zero, or
+    // a missing index, means reading all headers.
+    static void writeIndex(const std::string& filename, std::uint64_t knownSize = 0);
+
 protected:
     bool formatted;
     std::string inputFilename;
@@ -107,9 +132,20 @@ protected:
 private:
     std::vector<bool> arrayLoaded;
 
+    struct ScanFrom {
+        std::uint64_t value;
+    };
+
+    // Read the array headers of a binary file from byte offset
+    // 'scanFrom.value', without consulting its index.
+    EclFile(const std::string& filename, ScanFrom scanFrom);
+
     void loadBinaryArray(std::fstream& fileH, std::size_t arrIndex);
     void loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos);
-    void load(bool preload);
+    void load(bool preload, std::optional<std::uint64_t> scanFrom = std::nullopt);
+    std::uint64_t loadIndex(std::fstream& fileH);
+    void addArray(const std::string& name, eclArrType type, std::int64_t num,
+                  int sizeOfElement, std::uint64_t pos);
 
     std::vector<unsigned int> get_bin_logi_raw_values(int arrIndex) const;
     std::vector<std::string> get_fmt_real_raw_str_values(int arrIndex) const;
@@ -604,10 +604,7 @@ std::vector<std::string> ExtESmry::keywordList(const std::string& pattern) const
 {
     std::vector<std::string> list;
     std::copy_if(m_keyword.begin(), m_keyword.end(), std::back_inserter(list),
-                 [&pattern](const auto& key)
-                 {
-                     return shmatch(pattern, key);
-                 });
+                 ShellPattern { pattern });
 
     return list;
 }
@@ -291,7 +291,8 @@ Opm::EclIO::OutputStream::Restart::
 Restart(const ResultSet& rset,
         const int        seqnum,
         const Formatted& fmt,
-        const Unified&   unif)
+        const Unified&   unif,
+        const Indexed&   indexed)
 {
     const auto ext = FileExtension::
         restart(seqnum, fmt.set, unif.set);
@@ -300,7 +301,7 @@ Restart(const ResultSet& rset,
 
     if (unif.set) {
         // Run uses unified restart files.
-        this->openUnified(fname, fmt.set, seqnum);
+        this->openUnified(fname, fmt.set, seqnum, indexed.set);
 
         // Write SEQNUM value to stream to start new output sequence.
         this->stream_->write("SEQNUM", std::vector<int>{ seqnum });
@@ -313,20 +314,57 @@ Restart(const ResultSet& rset,
 }
 
 Opm::EclIO::OutputStream::Restart::~Restart()
-{}
+{
+    this->closeAndWriteIndex();
+}
 
 Opm::EclIO::OutputStream::Restart::Restart(Restart&& rhs)
     : stream_{ std::move(rhs.stream_) }
-{}
+    , index_ { std::move(rhs.index_) }
+{
+    rhs.index_.reset();
+}
 
 Opm::EclIO::OutputStream::Restart&
 Opm::EclIO::OutputStream::Restart::operator=(Restart&& rhs)
 {
-    this->stream_ = std::move(rhs.stream_);
+    if (this != &rhs) {
+        // Complete the report step currently written to this stream
+        // before taking over that of 'rhs'.
+        this->closeAndWriteIndex();
+
+        this->stream_ = std::move(rhs.stream_);
+        this->index_ = std::move(rhs.index_);
+        rhs.index_.reset();
+    }
 
     return *this;
 }
 
+void Opm::EclIO::OutputStream::Restart::closeAndWriteIndex()
+{
+    if (! this->index_.has_value() || (this->stream_ == nullptr)) {
+        return;
+    }
+
+    // Close the stream so the index sees all data of this report step.
+    this->stream_.reset();
+
+    const auto index = std::move(*this->index_);
+    this->index_.reset();
+
+    try {
+        EclFile::writeIndex(index.filename, index.knownSize);
+    }
+    catch (const std::exception& e) {
+        // The index is an optional accelerator.  Readers which find it
+        // out of date fall back to scanning the restart file.
+        Opm::OpmLog::warning("Failed to update restart file index '"
+                             + EclFile::indexFileName(index.filename)
+                             + "': " + e.what());
+    }
+}
+
 void Opm::EclIO::OutputStream::Restart::message(const std::string& msg)
 {
     this->stream().message(msg);
@@ -379,13 +417,21 @@ void
 Opm::EclIO::OutputStream::Restart::
 openUnified(const std::string& fname,
             const bool         formatted,
-            const int          seqnum)
+            const int          seqnum,
+            const bool         indexed)
 {
     // Determine if we're creating a new output/restart file or
     // if we're opening an existing one, possibly at a specific
     // write position.
     auto rst = Open::Restart::read(fname);
 
+    if (indexed && ! formatted) {
+        // Keep an index of the binary restart file.  Reopening the file
+        // for the next report step, e.g., the Open::Restart::read() call
+        // above, then only reads the index instead of every array header.
+        this->index_ = PendingIndex { fname, 0 };
+    }
+
     if (rst == nullptr) {
         // No such unified restart file exists.  Create new file.
         this->openNew(fname, formatted);
@@ -403,8 +449,16 @@ openUnified(const std::string& fname,
         // Restart file exists and appears to be a unified restart
         // resource.  Open writable restart stream backed by the
         // specific file.
-        this->openExisting(fname, formatted,
-                           rst->restartStepWritePosition(seqnum));
+        const auto writePos = rst->restartStepWritePosition(seqnum);
+
+        if (this->index_.has_value() && EclFile::hasValidIndex(fname)) {
+            // Everything before the write position is retained as is.
+            this->index_->knownSize = (writePos == std::streampos(-1))
+                ? std::filesystem::file_size(fname)
+                : static_cast<std::uint64_t>(std::streamoff(writePos));
+        }
+
+        this->openExisting(fname, formatted, writePos);
     }
 }
 
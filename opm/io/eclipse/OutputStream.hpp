@@ -25,8 +25,10 @@
 
 #include <array>
 #include <chrono>
+#include <cstdint>
 #include <ios>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -40,6 +42,7 @@ namespace Opm { namespace EclIO { namespace OutputStream {
 
     struct Formatted { bool set; };
     struct Unified   { bool set; };
+    struct Indexed   { bool set; };
 
     /// Abstract representation of an ECLIPSE-style result set.
     struct ResultSet
@@ -152,10 +155,14 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         /// \param[in] fmt Whether or not to create formatted output files.
         ///
         /// \param[in] unif Whether or not to create unified output files.
+        ///
+        /// \param[in] indexed Whether or not to keep an index of binary
+        ///    unified output files.  See EclFile::writeIndex().
         explicit Restart(const ResultSet& rset,
                          const int        seqnum,
                          const Formatted& fmt,
-                         const Unified&   unif);
+                         const Unified&   unif,
+                         const Indexed&   indexed = Indexed{ false });
 
         ~Restart();
 
@@ -223,9 +230,28 @@ namespace Opm { namespace EclIO { namespace OutputStream {
                    const std::vector<PaddedOutputString<8>>& data);
 
     private:
+        /// Index of a unified, binary restart file, to be updated once
+        /// the report step has been written.  See EclFile::writeIndex().
+        struct PendingIndex
+        {
+            /// Filename of restart file.
+            std::string filename{};
+
+            /// Number of leading bytes of the restart file which are
+            /// described by its existing index.
+            std::uint64_t knownSize{0};
+        };
+
         /// Restart output stream.
         std::unique_ptr<EclOutput> stream_;
 
+        /// Restart file index to update on closing the stream.
+        std::optional<PendingIndex> index_{};
+
+        /// Close the restart output stream and update the index of the
+        /// restart file, if any.
+        void closeAndWriteIndex();
+
         /// Open unified output file and place stream's output indicator
         /// in appropriate location.
         ///
@@ -238,9 +264,13 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         ///
         /// \param[in] seqnum Sequence number of new report.  One-based
         ///    report step ID.
+        ///
+        /// \param[in] indexed Whether or not to keep an index of a
+        ///    binary output file.
         void openUnified(const std::string& fname,
                          const bool         formatted,
-                         const int          seqnum);
+                         const int          seqnum,
+                         const bool         indexed);
 
         /// Open new output stream.
         ///
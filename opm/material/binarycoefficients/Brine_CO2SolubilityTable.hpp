@@ -0,0 +1,580 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::BinaryCoeff::Brine_CO2SolubilityTable
+ */
+#ifndef OPM_BINARY_COEFF_BRINE_CO2_SOLUBILITY_TABLE_HPP
+#define OPM_BINARY_COEFF_BRINE_CO2_SOLUBILITY_TABLE_HPP
+
+#include <opm/material/common/MathToolbox.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+namespace BinaryCoeff {
+
+/*!
+ * \ingroup Binarycoefficients
+ * \brief Tabulated mutual solubility of CO2 and brine.
+ *
+ * The mole fraction of CO2 in the liquid phase and of H2O in the gas phase
+ * for a two-phase system (i.e. Brine_CO2::calculateMoleFractions() with
+ * knownPhaseIdx < 0) are sampled on a tensor grid in temperature, pressure
+ * and salinity and interpolated trilinearly. Derivatives are obtained by
+ * evaluating the interpolant with the Evaluation type of the arguments.
+ *
+ * The grid is refined adaptively: an interval on one of the axes is split
+ * as long as the deviation between the sampled function and its linear
+ * interpolation at the midpoint of the interval exceeds the requested
+ * tolerance. This concentrates the sampling points where the solubility
+ * changes rapidly, e.g. close to the saturation line of CO2. The midpoint
+ * samples are kept between the refinement passes and become the samples of
+ * the inserted nodes, so the function is evaluated only once at each node
+ * of the final grid and at each midpoint which was checked.
+ *
+ * An axis may consist of a single point, e.g. the temperature of an
+ * isothermal model. The table then only applies to this value.
+ */
+template <class Scalar>
+class Brine_CO2SolubilityTable
+{
+public:
+    //! Returns {xlCO2, ygH2O} for a given (temperature, pressure, salinity)
+    using SolubilityFunction = std::function<std::pair<Scalar, Scalar>(Scalar, Scalar, Scalar)>;
+
+    Brine_CO2SolubilityTable() = default;
+
+    /*!
+     * \brief Tabulate the mutual solubility.
+     *
+     * \param solubility the (expensive) function to tabulate
+     * \param Tmin, Tmax the temperature range [K]. If Tmin equals Tmax, the
+     *        table only applies to this temperature.
+     * \param pmin, pmax the pressure range [Pa]
+     * \param salinities the salinities [kg NaCl / kg solution] for which the
+     *        table is required. If only a single value is given, the table is
+     *        two-dimensional and only applies to this salinity.
+     * \param tolerance the maximum allowed interpolation error of the mole fractions
+     * \param maxPointsPerAxis upper bound on the number of sampling points per
+     *        axis. Intervals are not split below the range of the axis divided
+     *        by the square of (maxPointsPerAxis - 1).
+     */
+    Brine_CO2SolubilityTable(const SolubilityFunction& solubility,
+                             Scalar Tmin, Scalar Tmax,
+                             Scalar pmin, Scalar pmax,
+                             std::vector<Scalar> salinities,
+                             Scalar tolerance = 1e-6,
+                             std::size_t maxPointsPerAxis = 513)
+    {
+        if (!(Tmin <= Tmax) || !(pmin < pmax)) {
+            throw std::invalid_argument("Invalid temperature or pressure range for CO2-brine solubility table");
+        }
+        if (salinities.empty()) {
+            throw std::invalid_argument("At least one salinity is required for CO2-brine solubility table");
+        }
+        if (maxPointsPerAxis < 2) {
+            throw std::invalid_argument("At least two points per axis are required for CO2-brine solubility table");
+        }
+
+        std::sort(salinities.begin(), salinities.end());
+        salinities.erase(std::unique(salinities.begin(), salinities.end()), salinities.end());
+
+        axes_[tempAxis] = (Tmin < Tmax) ? uniformAxis_(Tmin, Tmax, initialIntervals_)
+                                        : std::vector<Scalar>{Tmin};
+        axes_[presAxis] = uniformAxis_(pmin, pmax, initialIntervals_);
+        axes_[saltAxis] = std::move(salinities);
+
+        refine_(solubility, tolerance, maxPointsPerAxis);
+    }
+
+    /*!
+     * \brief Tabulate the mutual solubility once per process.
+     *
+     * Tables are shared by all callers passing equal ranges, salinities,
+     * tolerance and activity model, e.g. the brine and the gas PVT objects
+     * of a CO2STORE run, so that the table of a CO2SOLTB record is built
+     * only once. A table is released when the last caller drops it.
+     *
+     * \param activityModel the salt activity model of the solubility function
+     */
+    static std::shared_ptr<const Brine_CO2SolubilityTable>
+    shared(const SolubilityFunction& solubility,
+           Scalar Tmin, Scalar Tmax,
+           Scalar pmin, Scalar pmax,
+           std::vector<Scalar> salinities,
+           Scalar tolerance,
+           int activityModel)
+    {
+        std::sort(salinities.begin(), salinities.end());
+        salinities.erase(std::unique(salinities.begin(), salinities.end()), salinities.end());
+
+        const auto key = std::tuple{Tmin, Tmax, pmin, pmax, salinities, tolerance, activityModel};
+
+        static std::mutex mutex;
+        static std::map<decltype(key), std::weak_ptr<const Brine_CO2SolubilityTable>> tables;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& entry = tables[key];
+        auto table = entry.lock();
+        if (!table) {
+            table = std::make_shared<const Brine_CO2SolubilityTable>(solubility, Tmin, Tmax,
+                                                                     pmin, pmax,
+                                                                     std::move(salinities),
+                                                                     tolerance);
+            entry = table;
+        }
+        return table;
+    }
+
+    /*!
+     * \brief The salinities to tabulate for the salinities of the PVT regions.
+     *
+     * If the salinity follows the salt concentration, everything up to the
+     * solubility limit of NaCl in water (about 26 wt%) is covered.
+     */
+    static std::vector<Scalar> tabulatedSalinities(std::vector<Scalar> salinities,
+                                                   bool variableSalinity)
+    {
+        if (variableSalinity) {
+            const Scalar maxSalinity = salinities.empty()
+                ? Scalar{0.0} : *std::max_element(salinities.begin(), salinities.end());
+            return {Scalar{0.0}, std::max(Scalar{0.27}, maxSalinity)};
+        }
+        return salinities;
+    }
+
+    /*!
+     * \brief Returns true if the table has been initialized.
+     */
+    bool empty() const
+    { return xlCO2_.empty(); }
+
+    /*!
+     * \brief The maximum interpolation error which was observed at the
+     *        midpoints of the intervals during the last refinement pass.
+     *
+     * This is below the requested tolerance unless the number of sampling
+     * points hit the upper bound.
+     */
+    Scalar maxInterpolationError() const
+    { return maxError_; }
+
+    const std::vector<Scalar>& temperatures() const
+    { return axes_[tempAxis]; }
+
+    const std::vector<Scalar>& pressures() const
+    { return axes_[presAxis]; }
+
+    const std::vector<Scalar>& salinities() const
+    { return axes_[saltAxis]; }
+
+    /*!
+     * \brief Returns true iff a coordinate lies in the tabulated range
+     */
+    template <class Evaluation>
+    bool applies(const Evaluation& temperature,
+                 const Evaluation& pressure,
+                 const Evaluation& salinity) const
+    {
+        if (empty()) {
+            return false;
+        }
+
+        return appliesAxis_(tempAxis, scalarValue(temperature))
+            && appliesAxis_(presAxis, scalarValue(pressure))
+            && appliesAxis_(saltAxis, scalarValue(salinity));
+    }
+
+    /*!
+     * \brief Returns the interpolated mole fraction of CO2 in brine and of H2O
+     *        in the gas phase.
+     *
+     * The coordinate is required to lie in the tabulated range, see applies().
+     */
+    template <class Evaluation>
+    void calculateMoleFractions(const Evaluation& temperature,
+                                const Evaluation& pressure,
+                                const Evaluation& salinity,
+                                Evaluation& xlCO2,
+                                Evaluation& ygH2O) const
+    {
+        assert(applies(temperature, pressure, salinity));
+
+        const std::array<Scalar, 3> coord { scalarValue(temperature),
+                                            scalarValue(pressure),
+                                            scalarValue(salinity) };
+        const std::array<const Evaluation*, 3> value { &temperature, &pressure, &salinity };
+
+        std::array<std::size_t, 3> lower{};
+        std::array<Evaluation, 3> weight{};
+        for (int axis = 0; axis < 3; ++axis) {
+            lower[axis] = segmentIndex_(axis, coord[axis]);
+            weight[axis] = (numPoints_(axis) > 1) ? weight_(axis, lower[axis], *value[axis])
+                                                  : Evaluation{0.0};
+        }
+
+        xlCO2 = interpolate_(xlCO2_, lower, weight);
+        ygH2O = interpolate_(ygH2O_, lower, weight);
+    }
+
+private:
+    enum { tempAxis = 0, presAxis = 1, saltAxis = 2 };
+    static constexpr std::size_t initialIntervals_ = 16;
+
+    //! {xlCO2, ygH2O} at one node
+    using Sample = std::pair<Scalar, Scalar>;
+
+    using Dims = std::array<std::size_t, 3>;
+
+    //! Old node, or midpoint of an old interval, a node of a refined axis stems from
+    struct NodeOrigin
+    {
+        bool isMidpoint;
+        std::size_t index;
+    };
+
+    //! Samples at the midpoints of the intervals of one axis for all nodes of
+    //! the other two axes. Entries which have not been sampled yet are empty.
+    struct MidpointGrid
+    {
+        Dims dims{};
+        std::vector<std::optional<Sample>> samples{};
+    };
+
+    static std::vector<Scalar> uniformAxis_(Scalar min, Scalar max, std::size_t numIntervals)
+    {
+        std::vector<Scalar> axis(numIntervals + 1);
+        for (std::size_t i = 0; i <= numIntervals; ++i) {
+            axis[i] = min + i * (max - min) / numIntervals;
+        }
+        axis.back() = max;
+        return axis;
+    }
+
+    std::size_t numPoints_(int axis) const
+    { return axes_[axis].size(); }
+
+    std::size_t index_(std::size_t i, std::size_t j, std::size_t k) const
+    { return (k * numPoints_(presAxis) + j) * numPoints_(tempAxis) + i; }
+
+    bool appliesAxis_(int axis, Scalar value) const
+    {
+        const auto& pos = axes_[axis];
+        if (pos.size() == 1) {
+            return std::abs(value - pos.front()) <= 1e-10 * std::max(Scalar{1}, std::abs(pos.front()));
+        }
+
+        return pos.front() <= value && value <= pos.back();
+    }
+
+    std::size_t segmentIndex_(int axis, Scalar value) const
+    {
+        const auto& pos = axes_[axis];
+        if (pos.size() < 2) {
+            return 0;
+        }
+
+        const auto it = std::upper_bound(pos.begin() + 1, pos.end() - 1, value);
+        return static_cast<std::size_t>(std::distance(pos.begin(), it)) - 1;
+    }
+
+    template <class Evaluation>
+    Evaluation weight_(int axis, std::size_t idx, const Evaluation& value) const
+    {
+        const auto& pos = axes_[axis];
+        return (value - pos[idx]) / (pos[idx + 1] - pos[idx]);
+    }
+
+    // Multilinear interpolation between the 2^d corners of the grid cell,
+    // where d is the number of axes with more than one point
+    template <class Evaluation>
+    Evaluation interpolate_(const std::vector<Scalar>& samples,
+                            const std::array<std::size_t, 3>& lower,
+                            const std::array<Evaluation, 3>& weight) const
+    {
+        Evaluation result = 0.0;
+        for (int corner = 0; corner < 8; ++corner) {
+            std::array<std::size_t, 3> node = lower;
+            Evaluation cornerWeight = 1.0;
+            bool isCorner = true;
+            for (int axis = 0; axis < 3; ++axis) {
+                if ((corner & (1 << axis)) == 0) {
+                    cornerWeight *= 1.0 - weight[axis];
+                }
+                else if (numPoints_(axis) > 1) {
+                    node[axis] += 1;
+                    cornerWeight *= weight[axis];
+                }
+                else {
+                    isCorner = false;
+                }
+            }
+
+            if (isCorner) {
+                result += cornerWeight * samples[index_(node[tempAxis], node[presAxis], node[saltAxis])];
+            }
+        }
+        return result;
+    }
+
+    // Split the intervals of each axis for which the linear interpolation
+    // at the midpoint deviates more than the tolerance from the function,
+    // considering all combinations of sampling points of the other axes.
+    void refine_(const SolubilityFunction& solubility, Scalar tolerance, std::size_t maxPointsPerAxis)
+    {
+        sample_(solubility);
+
+        std::array<MidpointGrid, 3> midpoints{};
+        for (int axis = 0; axis < 3; ++axis) {
+            midpoints[axis].dims = nodeDims_();
+            midpoints[axis].dims[axis] = std::max<std::size_t>(numPoints_(axis), 1) - 1;
+            midpoints[axis].samples.resize(numEntries_(midpoints[axis].dims));
+        }
+
+        bool refined = true;
+        while (refined) {
+            refined = false;
+            maxError_ = 0.0;
+            for (int axis = 0; axis < 3; ++axis) {
+                const auto& pos = axes_[axis];
+                if (pos.size() < 2) {
+                    continue;
+                }
+
+                sampleMidpoints_(solubility, axis, midpoints[axis]);
+
+                // Intervals are not split below the range of the axis divided
+                // by the square of the maximum number of intervals, otherwise
+                // all points would be spent on a jump of the function. The
+                // spacing of a uniform axis with the maximum number of points
+                // would be too coarse for the steep solubility at low pressure.
+                const Scalar minWidth = (pos.back() - pos.front()) / ((maxPointsPerAxis - 1) * (maxPointsPerAxis - 1));
+
+                std::vector<bool> split(pos.size() - 1, false);
+                std::size_t numSplit = 0;
+                for (std::size_t idx = 0; idx + 1 < pos.size(); ++idx) {
+                    const Scalar error = midpointError_(axis, idx, midpoints[axis]);
+                    maxError_ = std::max(maxError_, error);
+                    if (error > tolerance
+                        && pos[idx + 1] - pos[idx] > 1.5 * minWidth
+                        && pos.size() + numSplit < maxPointsPerAxis)
+                    {
+                        split[idx] = true;
+                        ++numSplit;
+                    }
+                }
+
+                if (numSplit > 0) {
+                    splitIntervals_(axis, split, midpoints);
+                    refined = true;
+                }
+            }
+        }
+    }
+
+    // Evaluate the function at the midpoints of the intervals of an axis
+    // which have not been sampled yet
+    void sampleMidpoints_(const SolubilityFunction& solubility, int axis, MidpointGrid& grid) const
+    {
+        forEachNode_(grid.dims, [&](const Dims& node)
+        {
+            auto& sample = grid.samples[flatIndex_(grid.dims, node)];
+            if (sample.has_value()) {
+                return;
+            }
+
+            std::array<Scalar, 3> coord{};
+            for (int a = 0; a < 3; ++a) {
+                coord[a] = (a == axis) ? (axes_[a][node[a]] + axes_[a][node[a] + 1]) / 2
+                                       : axes_[a][node[a]];
+            }
+            sample = solubility(coord[tempAxis], coord[presAxis], coord[saltAxis]);
+        });
+    }
+
+    Scalar midpointError_(int axis, std::size_t idx, const MidpointGrid& grid) const
+    {
+        const int axis1 = (axis + 1) % 3;
+        const int axis2 = (axis + 2) % 3;
+
+        Scalar error = 0.0;
+        Dims node{};
+        for (std::size_t n1 = 0; n1 < numPoints_(axis1); ++n1) {
+            for (std::size_t n2 = 0; n2 < numPoints_(axis2); ++n2) {
+                node[axis1] = n1;
+                node[axis2] = n2;
+                node[axis] = idx;
+                const auto& [xlCO2, ygH2O] = *grid.samples[flatIndex_(grid.dims, node)];
+                const auto lower = flatIndex_(nodeDims_(), node);
+                node[axis] = idx + 1;
+                const auto upper = flatIndex_(nodeDims_(), node);
+
+                error = std::max(error, std::abs(xlCO2 - (xlCO2_[lower] + xlCO2_[upper]) / 2));
+                error = std::max(error, std::abs(ygH2O - (ygH2O_[lower] + ygH2O_[upper]) / 2));
+            }
+        }
+        return error;
+    }
+
+    // Split the marked intervals of an axis. The samples of the inserted
+    // nodes are taken from the midpoint samples. The midpoint samples of
+    // the unsplit intervals and those on the old nodes of the other axes
+    // are kept; the remaining ones are sampled in the next pass.
+    void splitIntervals_(int axis, const std::vector<bool>& split, std::array<MidpointGrid, 3>& midpoints)
+    {
+        const auto& pos = axes_[axis];
+        std::vector<Scalar> newPos { pos.front() };
+        std::vector<NodeOrigin> nodeOrigin { {false, 0} };
+        std::vector<std::optional<std::size_t>> oldNode { 0 };
+        std::vector<std::optional<std::size_t>> oldInterval;
+        for (std::size_t idx = 0; idx + 1 < pos.size(); ++idx) {
+            if (split[idx]) {
+                newPos.push_back((pos[idx] + pos[idx + 1]) / 2);
+                nodeOrigin.push_back({true, idx});
+                oldNode.push_back(std::nullopt);
+                oldInterval.insert(oldInterval.end(), 2, std::nullopt);
+            }
+            else {
+                oldInterval.push_back(idx);
+            }
+            newPos.push_back(pos[idx + 1]);
+            nodeOrigin.push_back({false, idx + 1});
+            oldNode.push_back(idx + 1);
+        }
+
+        const Dims oldDims = nodeDims_();
+        axes_[axis] = std::move(newPos);
+        const Dims newDims = nodeDims_();
+
+        const auto oldXlCO2 = std::move(xlCO2_);
+        const auto oldYgH2O = std::move(ygH2O_);
+        xlCO2_.assign(numEntries_(newDims), 0.0);
+        ygH2O_.assign(numEntries_(newDims), 0.0);
+
+        const auto& inserted = midpoints[axis];
+        forEachNode_(newDims, [&](Dims node)
+        {
+            const auto dst = flatIndex_(newDims, node);
+            const auto origin = nodeOrigin[node[axis]];
+            node[axis] = origin.index;
+            if (origin.isMidpoint) {
+                const auto& [xlCO2, ygH2O] = *inserted.samples[flatIndex_(inserted.dims, node)];
+                xlCO2_[dst] = xlCO2;
+                ygH2O_[dst] = ygH2O;
+            }
+            else {
+                xlCO2_[dst] = oldXlCO2[flatIndex_(oldDims, node)];
+                ygH2O_[dst] = oldYgH2O[flatIndex_(oldDims, node)];
+            }
+        });
+
+        for (int a = 0; a < 3; ++a) {
+            remapMidpoints_(midpoints[a], axis, (a == axis) ? oldInterval : oldNode);
+        }
+    }
+
+    // Rebuild a midpoint grid after the given axis has changed. Entry m
+    // along this axis is copied from entry origin[m] of the old grid, or
+    // left to be sampled if there is no such entry.
+    static void remapMidpoints_(MidpointGrid& grid, int axis,
+                                const std::vector<std::optional<std::size_t>>& origin)
+    {
+        const auto oldDims = grid.dims;
+        const auto oldSamples = std::move(grid.samples);
+        grid.dims[axis] = origin.size();
+        grid.samples.assign(numEntries_(grid.dims), std::nullopt);
+
+        forEachNode_(grid.dims, [&](Dims node)
+        {
+            const auto dst = flatIndex_(grid.dims, node);
+            if (const auto& src = origin[node[axis]]) {
+                node[axis] = *src;
+                grid.samples[dst] = oldSamples[flatIndex_(oldDims, node)];
+            }
+        });
+    }
+
+    Dims nodeDims_() const
+    { return { numPoints_(tempAxis), numPoints_(presAxis), numPoints_(saltAxis) }; }
+
+    static std::size_t numEntries_(const Dims& dims)
+    { return dims[tempAxis] * dims[presAxis] * dims[saltAxis]; }
+
+    static std::size_t flatIndex_(const Dims& dims, const Dims& node)
+    { return (node[saltAxis] * dims[presAxis] + node[presAxis]) * dims[tempAxis] + node[tempAxis]; }
+
+    template <class Function>
+    static void forEachNode_(const Dims& dims, Function f)
+    {
+        Dims node{};
+        for (node[saltAxis] = 0; node[saltAxis] < dims[saltAxis]; ++node[saltAxis]) {
+            for (node[presAxis] = 0; node[presAxis] < dims[presAxis]; ++node[presAxis]) {
+                for (node[tempAxis] = 0; node[tempAxis] < dims[tempAxis]; ++node[tempAxis]) {
+                    f(node);
+                }
+            }
+        }
+    }
+
+    void sample_(const SolubilityFunction& solubility)
+    {
+        const auto size = numPoints_(tempAxis) * numPoints_(presAxis) * numPoints_(saltAxis);
+        xlCO2_.resize(size);
+        ygH2O_.resize(size);
+        for (std::size_t k = 0; k < numPoints_(saltAxis); ++k) {
+            for (std::size_t j = 0; j < numPoints_(presAxis); ++j) {
+                for (std::size_t i = 0; i < numPoints_(tempAxis); ++i) {
+                    const auto [xlCO2, ygH2O] = solubility(axes_[tempAxis][i],
+                                                           axes_[presAxis][j],
+                                                           axes_[saltAxis][k]);
+                    xlCO2_[index_(i, j, k)] = xlCO2;
+                    ygH2O_[index_(i, j, k)] = ygH2O;
+                }
+            }
+        }
+    }
+
+    std::array<std::vector<Scalar>, 3> axes_{};
+    std::vector<Scalar> xlCO2_{};
+    std::vector<Scalar> ygH2O_{};
+    Scalar maxError_{0};
+};
+
+} // namespace BinaryCoeff
+} // namespace Opm
+
+#endif
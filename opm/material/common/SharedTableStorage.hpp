@@ -0,0 +1,108 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::SharedTableStorage
+ */
+#ifndef OPM_SHARED_TABLE_STORAGE_HPP
+#define OPM_SHARED_TABLE_STORAGE_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \brief Immutable sample storage which is shared between all copies.
+ *
+ * This can be used as the container type of the tabulated functions, e.g.
+ * UniformTabulated2DFunction<double, SharedTableStorage<float>>, such that
+ * copying a table (for instance as part of a fluid system or PVT object) does
+ * not copy the samples. The value type may be of lower precision than the
+ * scalar type used for interpolation.
+ *
+ * The storage is read-only, and thus safe to use from multiple threads.
+ */
+template <class T>
+class SharedTableStorage
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+    SharedTableStorage() = default;
+
+    explicit SharedTableStorage(std::vector<T> values)
+        : values_(std::make_shared<const std::vector<T>>(std::move(values)))
+    {}
+
+    //! Create the storage from values of a different type, e.g. double -> float.
+    template <class U>
+    explicit SharedTableStorage(const std::vector<U>& values)
+        : SharedTableStorage(std::vector<T>(values.begin(), values.end()))
+    {}
+
+    size_type size() const
+    { return values_ ? values_->size() : 0; }
+
+    bool empty() const
+    { return size() == 0; }
+
+    const T& operator[](size_type i) const
+    {
+        assert(values_ && i < values_->size());
+        return (*values_)[i];
+    }
+
+    const T* data() const
+    { return values_ ? values_->data() : nullptr; }
+
+    const_iterator begin() const
+    { return values_ ? values_->begin() : const_iterator{}; }
+
+    const_iterator end() const
+    { return values_ ? values_->end() : const_iterator{}; }
+
+    //! Returns whether the samples of two storage objects are physically shared.
+    bool sharesWith(const SharedTableStorage& other) const
+    { return values_ == other.values_; }
+
+    bool operator==(const SharedTableStorage& other) const
+    {
+        return this->sharesWith(other)
+            || (this->size() == other.size() &&
+                std::equal(this->begin(), this->end(), other.begin()));
+    }
+
+private:
+    std::shared_ptr<const std::vector<T>> values_{};
+};
+
+} // namespace Opm
+
+#endif // OPM_SHARED_TABLE_STORAGE_HPP
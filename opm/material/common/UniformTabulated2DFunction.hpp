@@ -32,6 +32,7 @@
 #include <opm/common/Exceptions.hpp>
 
 #include <opm/material/common/MathToolbox.hpp>
+#include <opm/material/common/SharedTableStorage.hpp>
 #include <opm/common/utility/gpuDecorators.hpp>
 
 #include <algorithm>
@@ -342,6 +343,14 @@ namespace Opm::gpuistl{
         return UniformTabulated2DFunction<ScalarT, GPUContainer>(tab.xMin(), tab.xMax(), tab.numX(), tab.yMin(), tab.yMax(), tab.numY(), GPUContainer(tab.samples()));
     }
 
+    // Shared samples are read-only, copy them via a host vector of the target type
+    template<class GPUContainer, class ScalarT, class T>
+    UniformTabulated2DFunction<ScalarT, GPUContainer>
+    copy_to_gpu(const UniformTabulated2DFunction<ScalarT, SharedTableStorage<T>>& tab){
+        const std::vector<typename GPUContainer::value_type> samples(tab.samples().begin(), tab.samples().end());
+        return UniformTabulated2DFunction<ScalarT, GPUContainer>(tab.xMin(), tab.xMax(), tab.numX(), tab.yMin(), tab.yMax(), tab.numY(), GPUContainer(samples));
+    }
+
     template <class ViewType, class ScalarT, class ContainerType>
     UniformTabulated2DFunction<ScalarT, ViewType>
     make_view(UniformTabulated2DFunction<ScalarT, ContainerType>& tab) {
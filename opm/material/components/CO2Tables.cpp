@@ -27,6 +27,9 @@
 #include <opm/material/common/UniformTabulated2DFunction.hpp>
 #include <opm/material/components/co2tables.inc>
 
+#include <utility>
+#include <vector>
+
 namespace Opm
 {
 
@@ -51,4 +54,47 @@ CO2Tables<Scalar, ContainerT>::CO2Tables()
 
 template CO2Tables<double, std::vector<double>>::CO2Tables();
 
+namespace {
+
+template <class Traits, class T>
+UniformTabulated2DFunction<double, SharedTableStorage<T>> sharedTable()
+{
+    std::vector<T> samples(Traits::numX * Traits::numY);
+    for (int i = 0; i < Traits::numX; ++i) {
+        for (int j = 0; j < Traits::numY; ++j) {
+            samples[j * Traits::numX + i] = static_cast<T>(Traits::vals[i][j]);
+        }
+    }
+
+    return {Traits::xMin, Traits::xMax, Traits::numX,
+            Traits::yMin, Traits::yMax, Traits::numY,
+            SharedTableStorage<T>(std::move(samples))};
+}
+
+// Process-wide tables, created once on first use (thread-safe).
+template <class T>
+const CO2Tables<double, SharedTableStorage<T>>& sharedCO2Tables()
+{
+    static const CO2Tables<double, SharedTableStorage<T>> tables {
+        sharedTable<co2TabulatedEnthalpyTraits, T>(),
+        sharedTable<co2TabulatedDensityTraits, T>()
+    };
+
+    return tables;
+}
+
+} // Anonymous namespace
+
+template<>
+SharedCO2Tables::CO2Tables()
+    : CO2Tables(sharedCO2Tables<double>())
+{
+}
+
+template<>
+CompactCO2Tables::CO2Tables()
+    : CO2Tables(sharedCO2Tables<float>())
+{
+}
+
 } // namespace Opm
@@ -25,8 +25,11 @@
 #define OPM_CO2TABLES_HPP
 
 #include <opm/material/common/MathToolbox.hpp>
+#include <opm/material/common/SharedTableStorage.hpp>
 #include <opm/material/common/UniformTabulated2DFunction.hpp>
 
+#include <vector>
+
 namespace Opm {
 
 struct co2TabulatedDensityTraits
@@ -80,6 +83,26 @@ public:
     }
 };
 
+/*!
+ * \brief CO2 tables which share their samples with all other instances in
+ *        the process, stored in double precision.
+ *
+ * Default constructed objects refer to a process-wide, read-only copy of the
+ * tabulated values, which is created on first use.
+ */
+using SharedCO2Tables = CO2Tables<double, SharedTableStorage<double>>;
+
+/*!
+ * \brief CO2 tables which share their samples with all other instances in
+ *        the process, stored in single precision.
+ *
+ * The interpolation is still performed in double precision.
+ */
+using CompactCO2Tables = CO2Tables<double, SharedTableStorage<float>>;
+
+template<> SharedCO2Tables::CO2Tables();
+template<> CompactCO2Tables::CO2Tables();
+
 } // namespace Opm
 
 namespace Opm::gpuistl {
@@ -45,11 +45,13 @@
 #include <dune/common/fmatrix.hh>
 #include <dune/common/classname.hh>
 
+#include <algorithm>
 #include <limits>
 #include <iostream>
 #include <iomanip>
 #include <stdexcept>
 #include <type_traits>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -88,37 +90,132 @@ public:
     {
         using ScalarFluidState = CompositionalFluidState<Scalar, FluidSystem>;
         ScalarFluidState fluid_state_scalar;
+        copyToScalarFluidState_(fluid_state, fluid_state_scalar);
 
-        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
-            fluid_state_scalar.setKvalue(compIdx, Opm::getValue(fluid_state.K(compIdx) ) );
-            fluid_state_scalar.setMoleFraction(compIdx, Opm::getValue(fluid_state.moleFraction(compIdx) ) );
-        }
+        const auto is_single_phase = flash_solve_scalar_(fluid_state_scalar, twoPhaseMethod, flash_tolerance, eos_type, verbosity);
 
-        fluid_state_scalar.setLvalue(Opm::getValue(fluid_state.L()));
-        // other values need to be Scalar, but I guess the fluidstate does not support it yet.
-        fluid_state_scalar.setPressure(FluidSystem::oilPhaseIdx,
-                                       Opm::getValue(fluid_state.pressure(FluidSystem::oilPhaseIdx)));
-        fluid_state_scalar.setPressure(FluidSystem::gasPhaseIdx,
-                                       Opm::getValue(fluid_state.pressure(FluidSystem::gasPhaseIdx)));
+        copyFromScalarFluidState_(fluid_state_scalar, fluid_state, eos_type, is_single_phase);
 
-        fluid_state_scalar.setTemperature(Opm::getValue(fluid_state.temperature(0)));
+        return is_single_phase;
+    } //end solve
 
-        const auto is_single_phase = flash_solve_scalar_(fluid_state_scalar, twoPhaseMethod, flash_tolerance, eos_type, verbosity);
+    /*!
+     * \brief Calculates the fluid states of a batch of cells
+     *
+     * The K-values and L stored in each fluid state are used as a warm start,
+     * typically they are the solution of the previous time step. The stored
+     * K-values of a cell which was single-phase are not used, since they may
+     * stem from an earlier state. Such a cell is re-initialized with Wilson
+     * K-values at the current pressure and temperature, as for a cold start,
+     * and is only subjected to the (expensive) phase stability test if it is
+     * close to the phase boundary, i.e. unless
+     * sum_i z_i K_i < 1 - stability_skip_tolerance (sub-cooled liquid) or
+     * sum_i z_i / K_i < 1 - stability_skip_tolerance (super-heated vapor).
+     * A negative tolerance always runs the stability test, which gives the
+     * same results as calling solve() for each cell.
+     *
+     * The Rachford-Rice equations of all two-phase cells are solved together
+     * by solveRachfordRiceBatch_(). On return, the K-values of the two-phase
+     * cells are updated with the converged values and those of single-phase
+     * cells with the Wilson K-values, to warm start the next call.
+     *
+     * \return Whether each of the cells is single-phase.
+     */
+    template <class FluidState>
+    static std::vector<bool> solveBatch(std::vector<FluidState>& fluid_states,
+                                        const std::string& twoPhaseMethod,
+                                        Scalar flash_tolerance,
+                                        const EOSType& eos_type,
+                                        Scalar stability_skip_tolerance = -1.0,
+                                        int verbosity = 0)
+    {
+        using ScalarFluidState = CompositionalFluidState<Scalar, FluidSystem>;
+        using ScalarVector = Dune::FieldVector<Scalar, numComponents>;
 
-        // the flash solution process were performed in scalar form, after the flash calculation finishes,
-        // ensure that things in fluid_state_scalar is transformed to fluid_state
-        for (int compIdx=0; compIdx<numComponents; ++compIdx){
-                const auto x_i = fluid_state_scalar.moleFraction(oilPhaseIdx, compIdx);
-                fluid_state.setMoleFraction(oilPhaseIdx, compIdx, x_i);
-                const auto y_i = fluid_state_scalar.moleFraction(gasPhaseIdx, compIdx);
-                fluid_state.setMoleFraction(gasPhaseIdx, compIdx, y_i);
+        const std::size_t num_cells = fluid_states.size();
+        std::vector<ScalarFluidState> fluid_states_scalar(num_cells);
+        std::vector<bool> is_single_phase(num_cells, false);
+
+        // K-values and global compositions of the two-phase cells, stored cell by cell
+        std::vector<std::size_t> two_phase_cells;
+        std::vector<Scalar> K_two_phase;
+        std::vector<Scalar> z_two_phase;
+
+        for (std::size_t cell = 0; cell < num_cells; ++cell) {
+            auto& fluid_state_scalar = fluid_states_scalar[cell];
+            copyToScalarFluidState_(fluid_states[cell], fluid_state_scalar);
+
+            ScalarVector K_scalar, z_scalar;
+            for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                K_scalar[compIdx] = fluid_state_scalar.K(compIdx);
+                z_scalar[compIdx] = fluid_state_scalar.moleFraction(compIdx);
+            }
+
+            bool is_stable = false;
+            const auto L_scalar = fluid_state_scalar.L();
+            if ( L_scalar <= 0 || L_scalar == 1 ) {
+                for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                    K_scalar[compIdx] = fluid_state_scalar.wilsonK_(compIdx);
+                    fluid_state_scalar.setKvalue(compIdx, K_scalar[compIdx]);
+                }
+
+                if (farFromPhaseBoundary_(K_scalar, z_scalar, stability_skip_tolerance)) {
+                    if (verbosity >= 1) {
+                        std::cout << "Skip stability test for cell " << cell << " far from the phase boundary!" << std::endl;
+                    }
+                    is_stable = true;
+                    for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                        fluid_state_scalar.setMoleFraction(gasPhaseIdx, compIdx, z_scalar[compIdx]);
+                        fluid_state_scalar.setMoleFraction(oilPhaseIdx, compIdx, z_scalar[compIdx]);
+                    }
+                } else {
+                    phaseStabilityTest_(is_stable, K_scalar, fluid_state_scalar, z_scalar, eos_type, verbosity);
+                }
+            }
+
+            is_single_phase[cell] = is_stable;
+            if (is_stable) {
+                fluid_state_scalar.setLvalue(li_single_phase_label_(fluid_state_scalar, z_scalar, verbosity));
+            } else {
+                two_phase_cells.push_back(cell);
+                K_two_phase.insert(K_two_phase.end(), K_scalar.begin(), K_scalar.end());
+                z_two_phase.insert(z_two_phase.end(), z_scalar.begin(), z_scalar.end());
+            }
         }
 
-        // we update the derivatives in fluid_state
-        updateDerivatives_(fluid_state_scalar, fluid_state, eos_type, is_single_phase);
+        std::vector<Scalar> L_two_phase;
+        solveRachfordRiceBatch_(K_two_phase, z_two_phase, L_two_phase, verbosity);
+
+        for (std::size_t i = 0; i < two_phase_cells.size(); ++i) {
+            auto& fluid_state_scalar = fluid_states_scalar[two_phase_cells[i]];
+            ScalarVector K_scalar, z_scalar;
+            for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                K_scalar[compIdx] = K_two_phase[i * numComponents + compIdx];
+                z_scalar[compIdx] = z_two_phase[i * numComponents + compIdx];
+            }
+
+            auto L_scalar = L_two_phase[i];
+            flash_2ph(z_scalar, twoPhaseMethod, K_scalar, L_scalar, fluid_state_scalar, flash_tolerance, eos_type, verbosity);
+            fluid_state_scalar.setLvalue(L_scalar);
+        }
+
+        for (std::size_t cell = 0; cell < num_cells; ++cell) {
+            const auto& fluid_state_scalar = fluid_states_scalar[cell];
+            auto& fluid_state = fluid_states[cell];
+            copyFromScalarFluidState_(fluid_state_scalar, fluid_state, eos_type, is_single_phase[cell]);
+
+            for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                if (is_single_phase[cell]) {
+                    fluid_state.setKvalue(compIdx, fluid_state_scalar.K(compIdx));
+                } else {
+                    fluid_state.setKvalue(compIdx, fluid_state_scalar.moleFraction(gasPhaseIdx, compIdx) /
+                                                   fluid_state_scalar.moleFraction(oilPhaseIdx, compIdx));
+                }
+            }
+        }
 
         return is_single_phase;
-    } //end solve
+    } //end solveBatch
 
     /*!
      * \brief Calculates the chemical equilibrium from the component
@@ -226,6 +323,100 @@ public:
         throw std::runtime_error(" Rachford-Rice did not converge within maximum number of iterations" );
     }
 
+    /*!
+     * \brief Solves the Rachford-Rice equation for a batch of cells
+     *
+     * K and z hold the values of cell i at [i*numComponents, (i+1)*numComponents).
+     * All cells are iterated simultaneously with the same Newton scheme as
+     * solveRachfordRice_g_(), using a structure-of-arrays layout such that the
+     * loops over the cells can be vectorized. Cells for which the Newton update
+     * leaves the bracketing interval, or which do not converge within a few
+     * iterations, are handed over to solveRachfordRice_g_().
+     */
+    static void solveRachfordRiceBatch_(const std::vector<Scalar>& K,
+                                        const std::vector<Scalar>& z,
+                                        std::vector<Scalar>& L,
+                                        int verbosity)
+    {
+        constexpr Scalar tol = 1e-12;
+        constexpr int itmax = 100;
+        const std::size_t num_cells = z.size() / numComponents;
+
+        // Transpose to component major order, i.e. Ks[compIdx*num_cells + cell]
+        std::vector<Scalar> Ks(K.size()), zs(z.size());
+        for (std::size_t cell = 0; cell < num_cells; ++cell) {
+            for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                Ks[compIdx * num_cells + cell] = K[cell * numComponents + compIdx];
+                zs[compIdx * num_cells + cell] = z[cell * numComponents + compIdx];
+            }
+        }
+
+        std::vector<Scalar> V(num_cells), Vmin(num_cells), Vmax(num_cells);
+        for (std::size_t cell = 0; cell < num_cells; ++cell) {
+            Scalar Kmin = Ks[cell];
+            Scalar Kmax = Ks[cell];
+            for (int compIdx = 1; compIdx < numComponents; ++compIdx) {
+                const auto Ki = Ks[compIdx * num_cells + cell];
+                if (Ki < Kmin)
+                    Kmin = Ki;
+                else if (Ki >= Kmax)
+                    Kmax = Ki;
+            }
+            Vmin[cell] = 1 / (1 - Kmax);
+            Vmax[cell] = 1 / (1 - Kmin);
+            V[cell] = (Vmin[cell] + Vmax[cell]) / 2;
+        }
+
+        // 0: iterating, 1: converged, 2: needs the scalar solver
+        std::vector<char> status(num_cells, 0);
+        std::vector<Scalar> r(num_cells), denum(num_cells);
+        L.assign(num_cells, 0.0);
+        std::size_t num_active = num_cells;
+        for (int iteration = 1; iteration < itmax && num_active > 0; ++iteration) {
+            std::fill(r.begin(), r.end(), 0.0);
+            std::fill(denum.begin(), denum.end(), 0.0);
+            for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                const Scalar* Kc = Ks.data() + compIdx * num_cells;
+                const Scalar* zc = zs.data() + compIdx * num_cells;
+                for (std::size_t cell = 0; cell < num_cells; ++cell) {
+                    const auto dK = Kc[cell] - 1.0;
+                    const auto b = 1 + V[cell] * dK;
+                    r[cell] += zc[cell] * dK / b;
+                    denum[cell] += zc[cell] * (dK * dK) / (b * b);
+                }
+            }
+
+            for (std::size_t cell = 0; cell < num_cells; ++cell) {
+                if (status[cell] != 0)
+                    continue;
+
+                V[cell] += r[cell] / denum[cell];
+                if (V[cell] < Vmin[cell] || V[cell] > Vmax[cell]) {
+                    status[cell] = 2;
+                    --num_active;
+                }
+                else if (Opm::abs(r[cell]) < tol) {
+                    L[cell] = 1 - V[cell];
+                    status[cell] = 1;
+                    --num_active;
+                }
+            }
+        }
+
+        using ScalarVector = Dune::FieldVector<Scalar, numComponents>;
+        for (std::size_t cell = 0; cell < num_cells; ++cell) {
+            if (status[cell] == 1)
+                continue;
+
+            ScalarVector K_cell, z_cell;
+            for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+                K_cell[compIdx] = K[cell * numComponents + compIdx];
+                z_cell[compIdx] = z[cell * numComponents + compIdx];
+            }
+            L[cell] = solveRachfordRice_g_(K_cell, z_cell, verbosity);
+        }
+    }
+
     // performing the flash calculation, which is done with Scalar without touching derivatives
     template <typename FluidState>
     static bool flash_solve_scalar_(FluidState& fluid_state,
@@ -416,6 +607,60 @@ public:
 
 protected:
 
+    template <class FluidState, class ScalarFluidState>
+    static void copyToScalarFluidState_(const FluidState& fluid_state,
+                                        ScalarFluidState& fluid_state_scalar)
+    {
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            fluid_state_scalar.setKvalue(compIdx, Opm::getValue(fluid_state.K(compIdx) ) );
+            fluid_state_scalar.setMoleFraction(compIdx, Opm::getValue(fluid_state.moleFraction(compIdx) ) );
+        }
+
+        fluid_state_scalar.setLvalue(Opm::getValue(fluid_state.L()));
+        // other values need to be Scalar, but I guess the fluidstate does not support it yet.
+        fluid_state_scalar.setPressure(FluidSystem::oilPhaseIdx,
+                                       Opm::getValue(fluid_state.pressure(FluidSystem::oilPhaseIdx)));
+        fluid_state_scalar.setPressure(FluidSystem::gasPhaseIdx,
+                                       Opm::getValue(fluid_state.pressure(FluidSystem::gasPhaseIdx)));
+
+        fluid_state_scalar.setTemperature(Opm::getValue(fluid_state.temperature(0)));
+    }
+
+    template <class ScalarFluidState, class FluidState>
+    static void copyFromScalarFluidState_(const ScalarFluidState& fluid_state_scalar,
+                                          FluidState& fluid_state,
+                                          const EOSType& eos_type,
+                                          bool is_single_phase)
+    {
+        // the flash solution process were performed in scalar form, after the flash calculation finishes,
+        // ensure that things in fluid_state_scalar is transformed to fluid_state
+        for (int compIdx=0; compIdx<numComponents; ++compIdx){
+                const auto x_i = fluid_state_scalar.moleFraction(oilPhaseIdx, compIdx);
+                fluid_state.setMoleFraction(oilPhaseIdx, compIdx, x_i);
+                const auto y_i = fluid_state_scalar.moleFraction(gasPhaseIdx, compIdx);
+                fluid_state.setMoleFraction(gasPhaseIdx, compIdx, y_i);
+        }
+
+        // we update the derivatives in fluid_state
+        updateDerivatives_(fluid_state_scalar, fluid_state, eos_type, is_single_phase);
+    }
+
+    // A negative tolerance disables the check, i.e. the stability test is always performed
+    template <class Vector>
+    static bool farFromPhaseBoundary_(const Vector& K, const Vector& z, Scalar tolerance)
+    {
+        if (tolerance < 0)
+            return false;
+
+        Scalar sum_zK = 0.0;
+        Scalar sum_z_over_K = 0.0;
+        for (int compIdx = 0; compIdx < numComponents; ++compIdx) {
+            sum_zK += z[compIdx] * K[compIdx];
+            sum_z_over_K += z[compIdx] / K[compIdx];
+        }
+        return (sum_zK < 1.0 - tolerance) || (sum_z_over_K < 1.0 - tolerance);
+    }
+
     template <class FlashFluidState>
     static typename FlashFluidState::Scalar wilsonK_(const FlashFluidState& fluid_state, int compIdx)
     {
@@ -466,6 +711,25 @@ protected:
             std::cout << std::setw(10) << "Iteration" << std::setw(16) << "K-Norm" << std::setw(16) << "R-Norm" << std::endl;
         }
 
+        const int phaseIdx = (isGas ? static_cast<int>(gasPhaseIdx) : static_cast<int>(oilPhaseIdx));
+        const int phaseIdx2 = (isGas ? static_cast<int>(oilPhaseIdx) : static_cast<int>(gasPhaseIdx));
+
+        // The global phase has the fixed composition z, so its fugacity
+        // coefficients do not change during the iterations below.
+        // TODO: not sure the following makes sense
+        for (int compIdx=0; compIdx<numComponents; ++compIdx){
+            fluid_state_global.setMoleFraction(phaseIdx2, compIdx, z[compIdx]);
+        }
+
+        typename FluidSystem::template ParameterCache<FlashEval> paramCache_global(eos_type);
+        paramCache_global.updatePhase(fluid_state_global, phaseIdx2);
+        for (int compIdx=0; compIdx<numComponents; ++compIdx){
+            auto phiGlobal = CubicEOS::computeFugacityCoefficient(fluid_state_global, paramCache_global, phaseIdx2, compIdx);
+            fluid_state_global.setFugacityCoefficient(phaseIdx2, compIdx, phiGlobal);
+        }
+
+        typename FluidSystem::template ParameterCache<FlashEval> paramCache_fake(eos_type);
+
         // Michelsens stability test.
         // Make two fake phases "inside" one phase and check for positive volume
         for (int i = 0; i < 20000; ++i) {
@@ -491,26 +755,12 @@ protected:
                 }
             }
 
-            int phaseIdx = (isGas ? static_cast<int>(gasPhaseIdx) : static_cast<int>(oilPhaseIdx));
-            int phaseIdx2 = (isGas ? static_cast<int>(oilPhaseIdx) : static_cast<int>(gasPhaseIdx));
-            // TODO: not sure the following makes sense
-            for (int compIdx=0; compIdx<numComponents; ++compIdx){
-                fluid_state_global.setMoleFraction(phaseIdx2, compIdx, z[compIdx]);
-            }
-
-            typename FluidSystem::template ParameterCache<FlashEval> paramCache_fake(eos_type);
             paramCache_fake.updatePhase(fluid_state_fake, phaseIdx);
 
-            typename FluidSystem::template ParameterCache<FlashEval> paramCache_global(eos_type);
-            paramCache_global.updatePhase(fluid_state_global, phaseIdx2);
-
             //fugacity for fake phases each component
             for (int compIdx=0; compIdx<numComponents; ++compIdx){
                 auto phiFake = CubicEOS::computeFugacityCoefficient(fluid_state_fake, paramCache_fake, phaseIdx, compIdx);
-                auto phiGlobal = CubicEOS::computeFugacityCoefficient(fluid_state_global, paramCache_global, phaseIdx2, compIdx);
-
                 fluid_state_fake.setFugacityCoefficient(phaseIdx, compIdx, phiFake);
-                fluid_state_global.setFugacityCoefficient(phaseIdx2, compIdx, phiGlobal);
             }
 
 
@@ -1101,13 +1351,13 @@ protected:
         //
         // Successive substitution loop
         //
+        using ParamCache = typename FluidSystem::template ParameterCache<typename FlashFluidState::Scalar>;
+        ParamCache paramCache(eos_type);
         for (int i=0; i < maxIterations; ++i){
             // Compute (normalized) liquid and vapor mole fractions
             computeLiquidVapor_(fluid_state, L, K, z);
 
             // Calculate fugacity coefficient
-            using ParamCache = typename FluidSystem::template ParameterCache<typename FlashFluidState::Scalar>;
-            ParamCache paramCache(eos_type);
             for (int phaseIdx=0; phaseIdx<numMisciblePhases; ++phaseIdx){
                 paramCache.updatePhase(fluid_state, phaseIdx);
                 for (int compIdx=0; compIdx<numComponents; ++compIdx){
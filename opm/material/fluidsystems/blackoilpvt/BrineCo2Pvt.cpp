@@ -33,6 +33,9 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <utility>
+
 namespace Opm {
 
 template<class Scalar, class Params, class ContainerT>
@@ -129,6 +132,14 @@ initFromState(const EclipseState& eclState, const Schedule&)
         co2ReferenceDensity_[regionIdx] = CO2::gasDensity(co2Tables_, T_ref, P_ref, extrapolate);
     }
 
+    if (const auto& table = eclState.getCo2StoreConfig().solubilityTable()) {
+        const Scalar rtemp = eclState.getTableManager().rtemp();
+        initSolubilityTable(table->temperature_min.value_or(rtemp),
+                            table->temperature_max.value_or(rtemp),
+                            table->pressure_min, table->pressure_max,
+                            table->tolerance);
+    }
+
     OpmLog::info(fmt::format("The surface density of CO2 is {:.6f} {}.",
                              usys.from_si(Meas::density, co2ReferenceDensity_[0]), usys.name(Meas::density)));
     OpmLog::info(fmt::format("The surface density of brine is {:.6f} {}.",
@@ -227,7 +238,44 @@ setEzrokhiViscCoeff(const std::vector<EzrokhiTable>& viscaqa)
                              static_cast<Scalar>(viscaqa[0].getC2("NACL"))};
 }
 
+template<class Scalar, class Params, class ContainerT>
+void BrineCo2Pvt<Scalar, Params, ContainerT>::
+initSolubilityTable(Scalar Tmin, Scalar Tmax,
+                    Scalar pmin, Scalar pmax,
+                    Scalar tolerance)
+{
+    const auto solubility = [this](Scalar T, Scalar p, Scalar S)
+    {
+        Scalar xlCO2{}, xgH2O{};
+        BinaryCoeffBrineCO2::calculateMoleFractions(co2Tables_, T, p, S,
+                                                    /*knownPhaseIdx=*/-1,
+                                                    xlCO2, xgH2O,
+                                                    activityModel_,
+                                                    extrapolate);
+        return std::pair{xlCO2, xgH2O};
+    };
+
+    // Shared with the gas PVT object, which tabulates the same function
+    solubilityTable_ = SolubilityTable::shared(solubility, Tmin, Tmax, pmin, pmax,
+                                               SolubilityTable::tabulatedSalinities(
+                                                   {salinity_.begin(), salinity_.end()},
+                                                   enableSaltConcentration_),
+                                               tolerance, activityModel_);
+
+    OpmLog::info(fmt::format("Tabulated the CO2-brine solubility using {} x {} x {} "
+                             "(temperature x pressure x salinity) sampling points, "
+                             "maximum interpolation error {:.3E}.",
+                             solubilityTable_->temperatures().size(),
+                             solubilityTable_->pressures().size(),
+                             solubilityTable_->salinities().size(),
+                             solubilityTable_->maxInterpolationError()));
+}
+
 template class BrineCo2Pvt<double>;
 template class BrineCo2Pvt<float>;
 
+// PVT objects owning their CO2 tables
+template class BrineCo2Pvt<double, CO2Tables<double, std::vector<double>>>;
+template class BrineCo2Pvt<float, CO2Tables<double, std::vector<double>>>;
+
 } // namespace Opm
@@ -42,10 +42,12 @@
 #include <opm/material/components/CO2Tables.hpp>
 #include <opm/material/binarycoefficients/H2O_CO2.hpp>
 #include <opm/material/binarycoefficients/Brine_CO2.hpp>
+#include <opm/material/binarycoefficients/Brine_CO2SolubilityTable.hpp>
 
 #include <opm/input/eclipse/EclipseState/Co2StoreConfig.hpp>
 
 #include <cstddef>
+#include <memory>
 #include <vector>
 
 namespace Opm {
@@ -69,8 +71,10 @@ namespace gpuistl {
 /*!
  * \brief This class represents the Pressure-Volume-Temperature relations of the liquid phase
  * for a CO2-Brine system
+ *
+ * By default, all instances share one copy of the CO2 tables, see SharedCO2Tables.
  */
-template <class Scalar, class Params = Opm::CO2Tables<double, std::vector<double>>, class ContainerT = std::vector<Scalar>>
+template <class Scalar, class Params = Opm::SharedCO2Tables, class ContainerT = std::vector<Scalar>>
 class BrineCo2Pvt
 {
     static constexpr bool extrapolate = true;
@@ -91,6 +95,9 @@ public:
     //! The binary coefficients for brine and CO2 used by this fluid system
     using BinaryCoeffBrineCO2 = BinaryCoeff::Brine_CO2<Scalar, H2O, CO2>;
 
+    //! The optional tabulation of the CO2-brine mutual solubility
+    using SolubilityTable = BinaryCoeff::Brine_CO2SolubilityTable<Scalar>;
+
     BrineCo2Pvt() = default;
 
     explicit BrineCo2Pvt(const ContainerT& salinity,
@@ -178,6 +185,31 @@ public:
 
     void setEzrokhiViscCoeff(const std::vector<EzrokhiTable>& viscaqa);
 
+    /*!
+     * \brief Tabulate the CO2-brine mutual solubility for a temperature and
+     *        pressure range.
+     *
+     * Saturated dissolution factors inside the range are then interpolated
+     * from the table instead of being computed by the (possibly iterative)
+     * solubility model. The table must be recreated if the salinity or the
+     * salt activity model are changed afterwards. The table is built once
+     * and shared with a Co2GasPvt for the same range and salinities.
+     *
+     * \param tolerance the maximum interpolation error of the mole fractions
+     */
+    void initSolubilityTable(Scalar Tmin, Scalar Tmax,
+                             Scalar pmin, Scalar pmax,
+                             Scalar tolerance = 1e-6);
+
+    /*!
+     * \brief Use a solubility table, e.g. one shared with Co2GasPvt.
+     */
+    void setSolubilityTable(std::shared_ptr<const SolubilityTable> table)
+    { solubilityTable_ = std::move(table); }
+
+    const std::shared_ptr<const SolubilityTable>& solubilityTable() const
+    { return solubilityTable_; }
+
     /*!
      * \brief Return the number of PVT regions which are considered by this PVT-object.
      */
@@ -533,6 +565,30 @@ public:
         // temperature and pressure.
         Evaluation xgH2O;
         Evaluation xlCO2;
+        calculateMoleFractions_(temperature, pressure, salinity, xlCO2, xgH2O);
+
+        // normalize the phase compositions
+        xlCO2 = max(0.0, min(1.0, xlCO2));
+
+        return convertXoGToRs(convertxoGToXoG(xlCO2, salinity), regionIdx);
+    }
+
+private:
+    // the mutual solubility of a two-phase system, taken from the solubility
+    // table if available
+    template <class Evaluation>
+    OPM_HOST_DEVICE void calculateMoleFractions_(const Evaluation& temperature,
+                                                 const Evaluation& pressure,
+                                                 const Evaluation& salinity,
+                                                 Evaluation& xlCO2,
+                                                 Evaluation& xgH2O) const
+    {
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (solubilityTable_ && solubilityTable_->applies(temperature, pressure, salinity)) {
+            solubilityTable_->calculateMoleFractions(temperature, pressure, salinity, xlCO2, xgH2O);
+            return;
+        }
+#endif
         BinaryCoeffBrineCO2::calculateMoleFractions(co2Tables_,
                                                     temperature,
                                                     pressure,
@@ -542,14 +598,8 @@ public:
                                                     xgH2O,
                                                     activityModel_,
                                                     extrapolate);
-
-        // normalize the phase compositions
-        xlCO2 = max(0.0, min(1.0, xlCO2));
-
-        return convertXoGToRs(convertxoGToXoG(xlCO2, salinity), regionIdx);
     }
 
-private:
     template <class LhsEval>
     OPM_HOST_DEVICE LhsEval ezrokhiExponent_(const LhsEval& temperature,
                              const ContainerT& ezrokhiCoeff) const
@@ -804,6 +854,7 @@ private:
     Co2StoreConfig::LiquidMixingType liquidMixType_{};
     Co2StoreConfig::SaltMixingType saltMixType_{};
     Params co2Tables_;
+    std::shared_ptr<const SolubilityTable> solubilityTable_{};
 };
 
 } // namespace Opm
@@ -811,9 +862,9 @@ private:
 namespace Opm::gpuistl
 {
 
-    template<class Params, class GPUContainer, class ScalarT>
+    template<class Params, class GPUContainer, class ScalarT, class CpuParams>
     BrineCo2Pvt<ScalarT, Params, GPUContainer>
-    copy_to_gpu(const BrineCo2Pvt<ScalarT>& cpuBrineCo2)
+    copy_to_gpu(const BrineCo2Pvt<ScalarT, CpuParams>& cpuBrineCo2)
     {
         return BrineCo2Pvt<ScalarT, Params, GPUContainer>(
             GPUContainer(cpuBrineCo2.getBrineReferenceDensity()),
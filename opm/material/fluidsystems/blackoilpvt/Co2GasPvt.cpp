@@ -31,6 +31,8 @@
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
 
+#include <utility>
+
 namespace Opm {
 
 template<class Scalar, class Params, class ContainerT>
@@ -106,6 +108,15 @@ initFromState(const EclipseState& eclState, const Schedule&)
         gasReferenceDensity_[regionIdx] = CO2::gasDensity(co2Tables, T_ref, P_ref, extrapolate);
     }
 
+    if (const auto& table = eclState.getCo2StoreConfig().solubilityTable()) {
+        const Scalar rtemp = eclState.getTableManager().rtemp();
+        initSolubilityTable(table->temperature_min.value_or(rtemp),
+                            table->temperature_max.value_or(rtemp),
+                            table->pressure_min, table->pressure_max,
+                            table->tolerance,
+                            eclState.runspec().phases().active(Phase::BRINE));
+    }
+
     initEnd();
 }
 #endif
@@ -179,7 +190,37 @@ setEzrokhiDenCoeff(const std::vector<EzrokhiTable>& denaqa)
                             static_cast<Scalar>(denaqa[0].getC2("NACL"))};
 }
 
+template<class Scalar, class Params, class ContainerT>
+void Co2GasPvt<Scalar, Params, ContainerT>::
+initSolubilityTable(Scalar Tmin, Scalar Tmax,
+                    Scalar pmin, Scalar pmax,
+                    Scalar tolerance,
+                    bool variableSalinity)
+{
+    const auto solubility = [this](Scalar T, Scalar p, Scalar S)
+    {
+        Scalar xlCO2{}, xgH2O{};
+        BinaryCoeffBrineCO2::calculateMoleFractions(co2Tables, T, p, S,
+                                                    /*knownPhaseIdx=*/-1,
+                                                    xlCO2, xgH2O,
+                                                    activityModel_,
+                                                    extrapolate);
+        return std::pair{xlCO2, xgH2O};
+    };
+
+    // Shared with the brine PVT object, which tabulates the same function
+    solubilityTable_ = SolubilityTable::shared(solubility, Tmin, Tmax, pmin, pmax,
+                                               SolubilityTable::tabulatedSalinities(
+                                                   {salinity_.begin(), salinity_.end()},
+                                                   variableSalinity),
+                                               tolerance, activityModel_);
+}
+
 template class Co2GasPvt<double>;
 template class Co2GasPvt<float>;
 
+// PVT objects owning their CO2 tables
+template class Co2GasPvt<double, CO2Tables<double, std::vector<double>>>;
+template class Co2GasPvt<float, CO2Tables<double, std::vector<double>>>;
+
 } // namespace Opm
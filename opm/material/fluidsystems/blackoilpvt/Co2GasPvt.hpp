@@ -37,12 +37,14 @@
 #include <opm/material/components/SimpleHuDuanH2O.hpp>
 #include <opm/material/common/UniformTabulated2DFunction.hpp>
 #include <opm/material/binarycoefficients/Brine_CO2.hpp>
+#include <opm/material/binarycoefficients/Brine_CO2SolubilityTable.hpp>
 #include <opm/input/eclipse/EclipseState/Co2StoreConfig.hpp>
 #include <opm/material/components/CO2Tables.hpp>
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
 
 #include <cstddef>
+#include <memory>
 #include <vector>
 
 namespace Opm {
@@ -65,8 +67,10 @@ namespace gpuistl {
 /*!
  * \brief This class represents the Pressure-Volume-Temperature relations of the gas phase
  *        for CO2.
+ *
+ * By default, all instances share one copy of the CO2 tables, see SharedCO2Tables.
  */
-template <class Scalar, class ParamsT = Opm::CO2Tables<double, std::vector<double>>, class ContainerT = std::vector<Scalar>>
+template <class Scalar, class ParamsT = Opm::SharedCO2Tables, class ContainerT = std::vector<Scalar>>
 class Co2GasPvt
 {
     using CO2 = ::Opm::CO2<Scalar, ParamsT>;
@@ -79,6 +83,9 @@ public:
     //! The binary coefficients for brine and CO2 used by this fluid system
     using BinaryCoeffBrineCO2 = BinaryCoeff::Brine_CO2<Scalar, H2O, CO2>;
 
+    //! The optional tabulation of the CO2-brine mutual solubility
+    using SolubilityTable = BinaryCoeff::Brine_CO2SolubilityTable<Scalar>;
+
     Co2GasPvt() = default;
 
     explicit Co2GasPvt(const ContainerT& salinity,
@@ -151,6 +158,35 @@ public:
     {
     }
 
+    /*!
+     * \brief Tabulate the CO2-brine mutual solubility for a temperature and
+     *        pressure range.
+     *
+     * Saturated water vaporization factors for the salinities of the PVT
+     * regions are then interpolated from the table instead of being computed
+     * by the (possibly iterative) solubility model. The table must be
+     * recreated if the salinity or the salt activity model are changed
+     * afterwards. The table is built once and shared with a BrineCo2Pvt for
+     * the same range and salinities.
+     *
+     * \param tolerance the maximum interpolation error of the mole fractions
+     * \param variableSalinity whether the salinity follows the salt
+     *        concentration, as in BrineCo2Pvt with salt enabled
+     */
+    void initSolubilityTable(Scalar Tmin, Scalar Tmax,
+                             Scalar pmin, Scalar pmax,
+                             Scalar tolerance = 1e-6,
+                             bool variableSalinity = false);
+
+    /*!
+     * \brief Use a solubility table, e.g. one shared with BrineCo2Pvt.
+     */
+    void setSolubilityTable(std::shared_ptr<const SolubilityTable> table)
+    { solubilityTable_ = std::move(table); }
+
+    const std::shared_ptr<const SolubilityTable>& solubilityTable() const
+    { return solubilityTable_; }
+
     /*!
      * \brief Return the number of PVT regions which are considered by this PVT-object.
      */
@@ -384,15 +420,23 @@ private:
         // temperature and pressure.
         LhsEval xgH2O;
         LhsEval xlCO2;
-        BinaryCoeffBrineCO2::calculateMoleFractions(co2Tables,
-                                                    temperature,
-                                                    pressure,
-                                                    salinity,
-                                                    /*knownPhaseIdx=*/-1,
-                                                    xlCO2,
-                                                    xgH2O,
-                                                    activityModel_,
-                                                    extrapolate);
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (solubilityTable_ && solubilityTable_->applies(temperature, pressure, salinity)) {
+            solubilityTable_->calculateMoleFractions(temperature, pressure, salinity, xlCO2, xgH2O);
+        }
+        else
+#endif
+        {
+            BinaryCoeffBrineCO2::calculateMoleFractions(co2Tables,
+                                                        temperature,
+                                                        pressure,
+                                                        salinity,
+                                                        /*knownPhaseIdx=*/-1,
+                                                        xlCO2,
+                                                        xgH2O,
+                                                        activityModel_,
+                                                        extrapolate);
+        }
 
         // normalize the phase compositions
         xgH2O = max(0.0, min(1.0, xgH2O));
@@ -459,14 +503,15 @@ private:
     int activityModel_{};
     Co2StoreConfig::GasMixingType gastype_{};
     Params co2Tables;
+    std::shared_ptr<const SolubilityTable> solubilityTable_{};
 };
 
 } // namespace Opm
 
 namespace Opm::gpuistl{
-    template<class GPUContainer, class Params, class ScalarT>
+    template<class GPUContainer, class Params, class ScalarT, class CpuParams>
     Co2GasPvt<ScalarT, Params, GPUContainer>
-    copy_to_gpu(const Co2GasPvt<ScalarT>& cpuCo2)
+    copy_to_gpu(const Co2GasPvt<ScalarT, CpuParams>& cpuCo2)
     {
         return Co2GasPvt<ScalarT, Params, GPUContainer>(
             copy_to_gpu<GPUContainer>(cpuCo2.getParams()),
@@ -24,6 +24,8 @@
 
 #include <opm/output/data/Wells.hpp>
 
+#include <opm/common/utility/ParallelFor.hpp>
+
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
@@ -38,6 +40,7 @@
 #include <exception>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
@@ -80,6 +83,9 @@ namespace {
         }
     }
 
+    // Wells are processed in parallel, since each well fills its own
+    // windows of the connection arrays.  The connections of a single well
+    // are processed in order.
     template <class ConnOp>
     void wellConnectionLoop(const Opm::Schedule&    sched,
                             const std::size_t       sim_step,
@@ -87,14 +93,26 @@ namespace {
                             const Opm::data::Wells& xw,
                             ConnOp&&                connOp)
     {
-        for (const auto& wname : sched.wellNames(sim_step)) {
-            const auto  well_iter = xw.find(wname);
-            const auto* wellRes   = (well_iter == xw.end())
-                ? nullptr : &well_iter->second;
+        const auto wnames = sched.wellNames(sim_step);
+
+        auto wells   = std::vector<const Opm::Well*>{};
+        auto wellRes = std::vector<const Opm::data::Well*>{};
+        wells.reserve(wnames.size());
+        wellRes.reserve(wnames.size());
+
+        for (const auto& wname : wnames) {
+            const auto well_iter = xw.find(wname);
 
-            connectionLoop(grid, sched.getWell(wname, sim_step),
-                           wellRes, connOp);
+            wells.push_back(&sched.getWell(wname, sim_step));
+            wellRes.push_back((well_iter == xw.end())
+                              ? nullptr : &well_iter->second);
         }
+
+        Opm::parallelFor(wells.size(),
+                         [&grid, &wells, &wellRes, &connOp](const std::size_t i)
+        {
+            connectionLoop(grid, *wells[i], wellRes[i], connOp);
+        });
     }
 
     namespace IConn {
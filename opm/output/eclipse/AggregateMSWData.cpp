@@ -22,6 +22,8 @@
 #include <opm/output/eclipse/InteHEAD.hpp>
 #include <opm/output/eclipse/VectorItems/msw.hpp>
 
+#include <opm/common/utility/ParallelFor.hpp>
+
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 
 #include <opm/input/eclipse/Schedule/MSW/AICD.hpp>
@@ -387,18 +389,18 @@ namespace {
         return (inFlowSegInd == -1) ? 0 : inFlowSegInd;
     }
 
+    // Each multi-segment well fills its own windows of the output arrays,
+    // so the wells are processed in parallel.
     template <typename MSWOp>
     void MSWLoop(const std::vector<const Opm::Well*>& wells,
                  MSWOp&&                              mswOp)
     {
-        auto mswID = std::size_t{0};
-        for (const auto* well : wells) {
-            mswID += 1;
-
-            if (well == nullptr) { continue; }
+        Opm::parallelFor(wells.size(), [&wells, &mswOp](const std::size_t mswID)
+        {
+            if (wells[mswID] == nullptr) { return; }
 
-            mswOp(*well, mswID - 1);
-        }
+            mswOp(*wells[mswID], mswID);
+        });
     }
 
     namespace ISeg {
@@ -25,6 +25,8 @@
 
 #include <opm/output/data/Wells.hpp>
 
+#include <opm/common/utility/ParallelFor.hpp>
+
 #include <opm/input/eclipse/Schedule/Action/ActionAST.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
@@ -101,16 +103,32 @@ namespace {
         return s.substr(b, e - b + 1);
     }
 
-    template <typename WellOp>
-    void wellLoop(const std::vector<std::string>& wells,
-                  const Opm::Schedule&            sched,
-                  const std::size_t               simStep,
-                  WellOp&&                        wellOp)
+    std::vector<const Opm::Well*>
+    getWells(const std::vector<std::string>& wells,
+             const Opm::Schedule&            sched,
+             const std::size_t               simStep)
     {
+        auto wellPtrs = std::vector<const Opm::Well*>{};
+        wellPtrs.reserve(wells.size());
+
         for (const auto& wname : wells) {
-            const auto& well = sched.getWell(wname, simStep);
-            wellOp(well, well.seqIndex());
+            wellPtrs.push_back(&sched.getWell(wname, simStep));
         }
+
+        return wellPtrs;
+    }
+
+    // Each well fills its own windows of the output arrays, so the wells
+    // are processed in parallel.  The well operation must not modify any
+    // state shared between wells.
+    template <typename WellOp>
+    void wellLoop(const std::vector<const Opm::Well*>& wells,
+                  WellOp&&                             wellOp)
+    {
+        Opm::parallelFor(wells.size(), [&wells, &wellOp](const std::size_t i)
+        {
+            wellOp(*wells[i], wells[i]->seqIndex());
+        });
     }
 
     namespace IWell {
@@ -1504,7 +1522,7 @@ captureDeclaredWellData(const Schedule&             sched,
                         const ::Opm::SummaryState&  smry,
                         const std::vector<int>&     inteHead)
 {
-    const auto& wells = sched.wellNames(sim_step);
+    const auto wells = getWells(sched.wellNames(sim_step), sched, sim_step);
     const auto& step_glo = sched.glo(sim_step);
 
     // Static contributions to IWEL array.
@@ -1512,27 +1530,36 @@ captureDeclaredWellData(const Schedule&             sched,
         const auto groupMapNameIndex =
             IWell::currentGroupMapNameIndex(sched, sim_step, inteHead);
 
-        auto msWellID = std::size_t{0};
-
-        wellLoop(wells, sched, sim_step,
-                 [&groupMapNameIndex, &msWellID,
-                  &step_glo, &wtest_state, &smry,
-                  &sched, &sim_step, this]
-                 (const Well& well, const std::size_t wellID) -> void
+        // Multi-segment well IDs (1-based) follow the order of 'wells'.
+        // Assign them up front since the wells are processed in parallel.
+        auto msWellIDs = std::vector<std::size_t>(wells.size(), 0);
         {
-            const auto& wtest_config = sched[sim_step].wtest_config();
+            auto msWellID = std::size_t{0};
+            for (std::size_t i = 0; i < wells.size(); ++i) {
+                msWellID += wells[i]->isMultiSegment();
+                msWellIDs[i] = msWellID;
+            }
+        }
 
-            msWellID += well.isMultiSegment();  // 1-based index.
-            auto iw   = this->iWell_[wellID];
+        const auto& wtest_config = sched[sim_step].wtest_config();
+
+        Opm::parallelFor(wells.size(),
+                         [&wells, &msWellIDs, &groupMapNameIndex,
+                          &step_glo, &wtest_config, &wtest_state,
+                          &smry, this]
+                         (const std::size_t i) -> void
+        {
+            const auto& well = *wells[i];
+            auto iw = this->iWell_[well.seqIndex()];
 
             IWell::staticContrib(well, step_glo, wtest_config, wtest_state,
-                                 smry, msWellID, groupMapNameIndex, iw);
+                                 smry, msWellIDs[i], groupMapNameIndex, iw);
         });
     }
 
     // Static contributions to SWEL array.
-    wellLoop(wells, sched, sim_step, [&step_glo, &sim_step, &sched,
-                                      &tracers, &wtest_state, &smry, this]
+    wellLoop(wells, [&step_glo, &sim_step, &sched,
+                     &tracers, &wtest_state, &smry, this]
              (const Well& well, const std::size_t wellID) -> void
     {
         auto sw = this->sWell_[wellID];
@@ -1542,7 +1569,7 @@ captureDeclaredWellData(const Schedule&             sched,
     });
 
     // Static contributions to XWEL array.
-    wellLoop(wells, sched, sim_step, [&sched, &smry, this]
+    wellLoop(wells, [&sched, &smry, this]
         (const Well& well, const std::size_t wellID) -> void
     {
         auto xw = this->xWell_[wellID];
@@ -1551,7 +1578,7 @@ captureDeclaredWellData(const Schedule&             sched,
     });
 
     // Static contributions to ZWEL array.
-    wellLoop(wells, sched, sim_step, [&sim_step, &action_state, &sched, this]
+    wellLoop(wells, [&sim_step, &action_state, &sched, this]
              (const Well& well, const std::size_t wellID) -> void
     {
         auto zw = this->zWell_[wellID];
@@ -1570,10 +1597,10 @@ captureDynamicWellData(const Opm::Schedule&       sched,
                        const Opm::data::Wells&    xw,
                        const ::Opm::SummaryState& smry)
 {
-    const auto& wells = sched.wellNames(sim_step);
+    const auto wells = getWells(sched.wellNames(sim_step), sched, sim_step);
 
     // Dynamic contributions to IWEL array.
-    wellLoop(wells, sched, sim_step, [this, &xw]
+    wellLoop(wells, [this, &xw]
         (const Well& well, const std::size_t wellID) -> void
     {
         auto iWell = this->iWell_[wellID];
@@ -1591,7 +1618,7 @@ captureDynamicWellData(const Opm::Schedule&       sched,
     });
 
     // Dynamic contributions to XWEL array.
-    wellLoop(wells, sched, sim_step, [this, &sched, &tracers, &smry]
+    wellLoop(wells, [this, &sched, &tracers, &smry]
         (const Well& well, const std::size_t wellID) -> void
     {
         auto xwell = this->xWell_[wellID];
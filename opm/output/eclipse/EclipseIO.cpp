@@ -362,7 +362,8 @@ void Opm::EclipseIO::Impl::writeRestartFile(const Action::State& action_state,
         EclIO::OutputStream::ResultSet { this->outputDir_, this->baseName_ },
         this->reportIndex(report_step, time_step),
         EclIO::OutputStream::Formatted { this->es_.get().cfg().io().getFMTOUT() },
-        EclIO::OutputStream::Unified   { this->es_.get().cfg().io().getUNIFOUT() }
+        EclIO::OutputStream::Unified   { this->es_.get().cfg().io().getUNIFOUT() },
+        EclIO::OutputStream::Indexed   { this->es_.get().cfg().io().getWriteRestartIndex() }
     };
 
     RestartIO::save(rstFile, report_step, secs_elapsed,
@@ -21,6 +21,8 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <numeric>
 #include <stdexcept>
 #include <string>
@@ -34,24 +36,15 @@ namespace {
 static const std::string FIELD_NAME = std::string{"FIELD"};
 static const std::size_t FIELD_ID   = 0;
 
-std::size_t region_max(const std::unordered_map<std::size_t, double>& region_map)
-{
-    return std::accumulate(region_map.begin(), region_map.end(), std::size_t{0},
-                           [](const std::size_t max, const auto& elm)
-                           {
-                               return std::max(max, elm.first);
-                           });
-}
-
-std::size_t
-phase_region_max(const std::unordered_map<Opm::Inplace::Phase, std::unordered_map<std::size_t, double>>& phase_map)
+template <typename PhaseMap>
+std::size_t phase_region_max(const PhaseMap& phase_map)
 {
     return std::accumulate(phase_map.begin(),
                            phase_map.end(),
                            std::size_t{0},
         [](const std::size_t max, const auto& region_map)
     {
-        return std::max(max, region_max(region_map.second));
+        return std::max(max, region_map.second.max_region());
     });
 }
 
@@ -129,12 +122,44 @@ std::string Inplace::EclString(const Phase phase)
     return it->second;
 }
 
+std::size_t Inplace::ValueMap::max_region() const
+{
+    // Values are never removed, so the last element is always assigned.
+    return this->values.empty() ? 0 : this->values.size() - 1;
+}
+
 void Inplace::add(const std::string&   region,
                   const Inplace::Phase phase,
                   const std::size_t    region_id,
                   const double         value)
 {
-    this->phase_values[region][phase][region_id] = value;
+    auto& value_map = this->phase_values[region][phase];
+    if (region_id >= value_map.values.size()) {
+        value_map.values.resize(region_id + 1, 0.0);
+        value_map.assigned.resize(region_id + 1, 0);
+    }
+
+    value_map.values[region_id] = value;
+    value_map.assigned[region_id] = 1;
+}
+
+void Inplace::add(const std::string&         region,
+                  const Inplace::Phase       phase,
+                  const std::vector<double>& values)
+{
+    if (values.empty()) {
+        return;
+    }
+
+    auto& value_map = this->phase_values[region][phase];
+    if (values.size() >= value_map.values.size()) {
+        value_map.values.resize(values.size() + 1, 0.0);
+        value_map.assigned.resize(values.size() + 1, 0);
+    }
+
+    std::copy(values.begin(), values.end(), value_map.values.begin() + 1);
+    std::fill(value_map.assigned.begin() + 1,
+              value_map.assigned.begin() + 1 + values.size(), 1);
 }
 
 void Inplace::add(Inplace::Phase phase, double value)
@@ -161,15 +186,15 @@ double Inplace::get(const std::string&   region,
         };
     }
 
-    auto value_iter = phase_iter->second.find(region_id);
-    if (value_iter == phase_iter->second.end()) {
+    const auto& value_map = phase_iter->second;
+    if ((region_id >= value_map.assigned.size()) || !value_map.assigned[region_id]) {
         throw std::logic_error {
             fmt::format("No such region id: {}:{}:{}",
                         region, static_cast<int>(phase), region_id)
         };
     }
 
-    return value_iter->second;
+    return value_map.values[region_id];
 }
 
 double Inplace::get(Inplace::Phase phase) const
@@ -191,8 +216,8 @@ bool Inplace::has(const std::string& region,
         return false;
     }
 
-    return phase_iter->second.find(region_id)
-        != phase_iter->second.end();
+    const auto& assigned = phase_iter->second.assigned;
+    return (region_id < assigned.size()) && assigned[region_id];
 }
 
 bool Inplace::has(Phase phase) const
@@ -244,13 +269,68 @@ Inplace::get_vector(const std::string& region,
         };
     }
 
-    for (const auto& [region_id, value] : phase_iter->second) {
-        v[region_id - 1] = value;
+    const auto& value_map = phase_iter->second;
+    for (std::size_t region_id = 1; region_id < value_map.values.size(); ++region_id) {
+        if (value_map.assigned[region_id]) {
+            v[region_id - 1] = value_map.values[region_id];
+        }
     }
 
     return v;
 }
 
+std::vector<double>
+Inplace::regionSums(const std::vector<int>&    region_id,
+                    const std::vector<double>& cell_values,
+                    const std::size_t          max_region_id)
+{
+    if (region_id.size() != cell_values.size()) {
+        throw std::invalid_argument {
+            fmt::format("Region ID array size {} does not match "
+                        "cell value array size {}",
+                        region_id.size(), cell_values.size())
+        };
+    }
+
+    // The cells are split into a number of blocks which depends only on
+    // the number of cells and regions.  Each block is summed into its own
+    // partial result, and the partial results are then added in block
+    // order.  The number of blocks is limited such that the partial
+    // results take no more space than the cell values.
+    constexpr std::size_t max_blocks = 64;
+    constexpr std::size_t min_block_size = 4096;
+    const auto num_cells = region_id.size();
+    const auto max_blocks_memory = std::max(std::size_t{1}, num_cells / std::max(std::size_t{1}, max_region_id));
+    const auto num_blocks = static_cast<std::int64_t>
+        (std::clamp((num_cells + min_block_size - 1) / min_block_size,
+                    std::size_t{1}, std::min(max_blocks, max_blocks_memory)));
+    const auto block_size = (num_cells + num_blocks - 1) / num_blocks;
+
+    std::vector<double> partial(num_blocks * max_region_id, 0.0);
+
+#pragma omp parallel for schedule(static)
+    for (std::int64_t block = 0; block < num_blocks; ++block) {
+        auto* sums = partial.data() + block * max_region_id;
+
+        const auto end = std::min(num_cells, (block + 1) * block_size);
+        for (std::size_t cell = block * block_size; cell < end; ++cell) {
+            const auto id = static_cast<std::size_t>(region_id[cell]) - 1;
+            if (id < max_region_id) {
+                sums[id] += cell_values[cell];
+            }
+        }
+    }
+
+    std::vector<double> result(max_region_id, 0.0);
+    for (std::int64_t block = 0; block < num_blocks; ++block) {
+        const auto* sums = partial.data() + block * max_region_id;
+        std::transform(result.begin(), result.end(), sums,
+                       result.begin(), std::plus<>{});
+    }
+
+    return result;
+}
+
 const std::vector<Inplace::Phase>& Inplace::phases()
 {
     static const auto phases_ = append(std::vector {
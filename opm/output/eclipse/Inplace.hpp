@@ -32,6 +32,12 @@ namespace Opm {
 // to fit in with the current implementation in the simulator.  Functions
 // which do not take both region set name and region ID arguments are
 // intended for field-level values.
+//
+// The values of each quantity in a region set are stored densely, indexed
+// by region ID.  The memory use is thus proportional to the largest region
+// ID assigned, i.e., about 9 bytes per region up to the model's maximum FIP
+// region ID, for each region set and quantity, regardless of how many of
+// those regions are actually assigned.
 class Inplace
 {
 public:
@@ -102,11 +108,27 @@ public:
     ///
     /// \param[in] value Numerical value of \p phase quantity in \p
     ///   region_number region of \p region region set.
+    ///
+    /// Grows the storage of \p phase in \p region to \p region_number
+    /// elements if needed.
     void add(const std::string& region,
              Phase              phase,
              std::size_t        region_number,
              double             value);
 
+    /// Assign values of particular quantity in all regions of named region
+    /// set.
+    ///
+    /// \param[in] region Region set name such as FIPNUM or FIPABC.
+    ///
+    /// \param[in] phase In-place quantity.
+    ///
+    /// \param[in] values Numerical values of \p phase quantity, indexed by
+    ///   (region_number - 1), e.g., as computed by regionSums().
+    void add(const std::string&         region,
+             Phase                      phase,
+             const std::vector<double>& values);
+
     /// Assign field-level value of particular quantity.
     ///
     /// \param[in] phase In-place quantity.
@@ -195,6 +217,28 @@ public:
     std::vector<double>
     get_vector(const std::string& region, Phase phase) const;
 
+    /// Sum cell values per region.
+    ///
+    /// Cells whose region ID is outside [1, max_region_id] do not
+    /// contribute.  The summation order depends only on the number of
+    /// cells and regions, not on the number of threads, so the result is
+    /// reproducible.  The temporary storage is at most
+    /// max(cell_values.size(), max_region_id) values.
+    ///
+    /// \param[in] region_id Region ID of each cell.
+    ///
+    /// \param[in] cell_values Cell values to sum.  Same size as \p
+    ///   region_id.
+    ///
+    /// \param[in] max_region_id Number of regions, e.g., as reported by
+    ///   FIPRegionStatistics::maximumRegionID().
+    ///
+    /// \return Per-region sums, indexed by (region_number - 1).
+    static std::vector<double>
+    regionSums(const std::vector<int>&    region_id,
+               const std::vector<double>& cell_values,
+               std::size_t                max_region_id);
+
     /// Get iterable list of all quantities which can be handled/updated in
     /// a generic way.
     static const std::vector<Phase>& phases();
@@ -223,7 +267,29 @@ public:
     bool operator==(const Inplace& rhs) const;
 
 private:
-    using ValueMap = std::unordered_map<std::size_t, double>;
+    /// Values of a single quantity in a single region set, stored densely
+    /// and indexed by region ID.  Region ID zero holds field-level values.
+    struct ValueMap
+    {
+        std::vector<double> values{};
+        std::vector<char> assigned{};
+
+        std::size_t max_region() const;
+
+        bool operator==(const ValueMap& rhs) const
+        {
+            return (this->values == rhs.values)
+                && (this->assigned == rhs.assigned);
+        }
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(values);
+            serializer(assigned);
+        }
+    };
+
     using PhaseMap = std::unordered_map<Phase, ValueMap>;
     using RegionMap = std::unordered_map<std::string, PhaseMap>;
 
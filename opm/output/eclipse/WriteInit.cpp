@@ -42,9 +42,15 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <future>
 #include <initializer_list>
+#include <memory>
 #include <stdexcept>
+#include <string>
+#include <system_error>
 #include <utility>
+#include <vector>
 
 namespace {
 
@@ -241,6 +247,66 @@ namespace {
         return { x.begin(), x.end() };
     }
 
+    /// Writes arrays to the INIT file on a background thread.
+    ///
+    /// At most one array is in flight.  Submitting an array waits for the
+    /// previous one to be written, so the arrays appear in the file in
+    /// submission order, while the caller prepares the next array--fetching
+    /// properties, converting units--during the write of the previous one.
+    class PipelinedInitFile
+    {
+    public:
+        explicit PipelinedInitFile(::Opm::EclIO::OutputStream::Init& initFile)
+            : initFile_ { initFile }
+        {}
+
+        PipelinedInitFile(const PipelinedInitFile&) = delete;
+        PipelinedInitFile& operator=(const PipelinedInitFile&) = delete;
+
+        ~PipelinedInitFile()
+        {
+            // Don't leave a write running if preparing an array failed.
+            // Any error from that write is superseded by the pending
+            // exception.
+            if (this->pending_.valid()) {
+                this->pending_.wait();
+            }
+        }
+
+        template <typename T>
+        void write(const std::string& kw, std::vector<T> data)
+        {
+            this->finish();
+
+            auto writeArray = [this, kw,
+                               array = std::make_shared<const std::vector<T>>(std::move(data))]()
+            {
+                this->initFile_.write(kw, *array);
+            };
+
+            try {
+                this->pending_ = std::async(std::launch::async, writeArray);
+            }
+            catch (const std::system_error&) {
+                // No thread available.  Write on the calling thread.
+                writeArray();
+            }
+        }
+
+        /// Wait for the last submitted array to be written.  Rethrows any
+        /// exception raised while writing it.
+        void finish()
+        {
+            if (this->pending_.valid()) {
+                this->pending_.get();
+            }
+        }
+
+    private:
+        ::Opm::EclIO::OutputStream::Init& initFile_;
+        std::future<void> pending_{};
+    };
+
     ::Opm::RestartIO::LogiHEAD::PVTModel
     pvtFlags(const ::Opm::Runspec& rspec, const ::Opm::TableManager& tabMgr)
     {
@@ -296,7 +362,7 @@ namespace {
     void writeInitFileHeader(const ::Opm::EclipseState&      es,
                              const ::Opm::EclipseGrid&       grid,
                              const ::Opm::Schedule&          sched,
-                             Opm::EclIO::OutputStream::Init& initFile)
+                             PipelinedInitFile&              initFile)
     {
         {
             const auto ih = ::Opm::RestartIO::Helpers::
@@ -319,7 +385,7 @@ namespace {
 
     void writePoreVolume(const ::Opm::EclipseState&        es,
                          const ::Opm::UnitSystem&          units,
-                         ::Opm::EclIO::OutputStream::Init& initFile)
+                         PipelinedInitFile&                initFile)
     {
         auto porv = es.globalFieldProps().porv(true);
         units.from_si(::Opm::UnitSystem::measure::volume, porv);
@@ -327,7 +393,7 @@ namespace {
     }
 
     void writeIntegerCellProperties(const ::Opm::EclipseState&        es,
-                                    ::Opm::EclIO::OutputStream::Init& initFile)
+                                    PipelinedInitFile&                initFile)
     {
         // The INIT file should always contain PVT, saturation function,
         // equilibration, and fluid-in-place region vectors.
@@ -349,30 +415,31 @@ namespace {
 
     void writeGridGeometry(const ::Opm::EclipseGrid&         grid,
                            const ::Opm::UnitSystem&          units,
-                           ::Opm::EclIO::OutputStream::Init& initFile)
+                           PipelinedInitFile&                initFile)
     {
         const auto length = ::Opm::UnitSystem::measure::length;
         const auto nAct   = grid.getNumActive();
 
-        auto dx    = std::vector<float>{};  dx   .reserve(nAct);
-        auto dy    = std::vector<float>{};  dy   .reserve(nAct);
-        auto dz    = std::vector<float>{};  dz   .reserve(nAct);
-        auto depth = std::vector<float>{};  depth.reserve(nAct);
+        auto dx    = std::vector<float>(nAct);
+        auto dy    = std::vector<float>(nAct);
+        auto dz    = std::vector<float>(nAct);
+        auto depth = std::vector<float>(nAct);
 
-        for (auto cell = 0*nAct; cell < nAct; ++cell) {
+#pragma omp parallel for schedule(static)
+        for (std::int64_t cell = 0; cell < static_cast<std::int64_t>(nAct); ++cell) {
             const auto  globCell = grid.getGlobalIndex(cell);
             const auto& dims     = grid.getCellDims(globCell);
 
-            dx   .push_back(units.from_si(length, dims[0]));
-            dy   .push_back(units.from_si(length, dims[1]));
-            dz   .push_back(units.from_si(length, dims[2]));
-            depth.push_back(units.from_si(length, grid.getCellDepth(globCell)));
+            dx   [cell] = units.from_si(length, dims[0]);
+            dy   [cell] = units.from_si(length, dims[1]);
+            dz   [cell] = units.from_si(length, dims[2]);
+            depth[cell] = units.from_si(length, grid.getCellDepth(globCell));
         }
 
-        initFile.write("DEPTH", depth);
-        initFile.write("DX"   , dx);
-        initFile.write("DY"   , dy);
-        initFile.write("DZ"   , dz);
+        initFile.write("DEPTH", std::move(depth));
+        initFile.write("DX"   , std::move(dx));
+        initFile.write("DY"   , std::move(dy));
+        initFile.write("DZ"   , std::move(dz));
     }
 
     template <class WriteVector>
@@ -411,7 +478,7 @@ namespace {
                                    const ::Opm::FieldPropsManager&      fp,
                                    const ::Opm::UnitSystem&             units,
                                    const bool                           needDflt,
-                                   ::Opm::EclIO::OutputStream::Init&    initFile)
+                                   PipelinedInitFile&                   initFile)
     {
         if (needDflt) {
             writeCellDoublePropertiesWithDefaultFlag(propList, fp,
@@ -448,7 +515,7 @@ namespace {
 
     void writeDoubleCellProperties(const ::Opm::EclipseState&        es,
                                    const ::Opm::UnitSystem&          units,
-                                   ::Opm::EclIO::OutputStream::Init& initFile)
+                                   PipelinedInitFile&                initFile)
     {
         const auto doubleKeywords = Properties {
             // do not reorder the fields below
@@ -479,7 +546,7 @@ namespace {
 
     void writeSimulatorProperties(const ::Opm::EclipseGrid&         grid,
                                   const ::Opm::data::Solution&      simProps,
-                                  ::Opm::EclIO::OutputStream::Init& initFile)
+                                  PipelinedInitFile&                initFile)
     {
         for (const auto& prop : simProps) {
             const auto& value = grid.compressedVector(prop.second.data<double>());
@@ -490,7 +557,7 @@ namespace {
 
     void writeTableData(const ::Opm::EclipseState&        es,
                         const ::Opm::UnitSystem&          units,
-                        ::Opm::EclIO::OutputStream::Init& initFile)
+                        PipelinedInitFile&                initFile)
     {
         ::Opm::Tables tables(units);
 
@@ -502,10 +569,10 @@ namespace {
         initFile.write("TAB"    , tables.tab());
     }
 
-    void writeIntegerMaps(const std::map<std::string, std::vector<int>>& mapData,
-                          ::Opm::EclIO::OutputStream::Init&       initFile)
+    void writeIntegerMaps(std::map<std::string, std::vector<int>>&& mapData,
+                          PipelinedInitFile&                        initFile)
     {
-        for (const auto& pair : mapData) {
+        for (auto& pair : mapData) {
             const auto& key = pair.first;
 
             if (key.size() > std::size_t{8}) {
@@ -514,14 +581,14 @@ namespace {
                 };
             }
 
-            initFile.write(key, pair.second);
+            initFile.write(key, std::move(pair.second));
         }
     }
 
     void writeFilledSatFuncScaling(const Properties&                 propList,
                                    ::Opm::FieldPropsManager&&        fp,
                                    const ::Opm::UnitSystem&          units,
-                                   ::Opm::EclIO::OutputStream::Init& initFile)
+                                   PipelinedInitFile&                initFile)
     {
         for (const auto& prop : propList) {
             if (prop.supports_auto_create) {
@@ -535,7 +602,7 @@ namespace {
 
     void writeSatFuncScaling(const ::Opm::EclipseState&        es,
                              const ::Opm::UnitSystem&          units,
-                             ::Opm::EclIO::OutputStream::Init& initFile)
+                             PipelinedInitFile&                initFile)
     {
         const auto epsVectors = ScalingVectors{}
             .withHysteresis(es.runspec().hysterPar().active())
@@ -568,7 +635,7 @@ namespace {
 
     void writeNonNeighbourConnections(const std::vector<::Opm::NNCdata>& nnc,
                                       const ::Opm::UnitSystem&           units,
-                                      ::Opm::EclIO::OutputStream::Init&  initFile)
+                                      PipelinedInitFile&                 initFile)
     {
         auto tran = std::vector<double>{};
         tran.reserve(nnc.size());
@@ -584,7 +651,7 @@ namespace {
     // output aquifer cell and aquifer connection information for numerical aquifers
     void writeNumericalAquifers(const Opm::NumericalAquifers& num_aquifers,
                                 const ::Opm::EclipseGrid&          grid,
-                                ::Opm::EclIO::OutputStream::Init&  initFile)
+                                PipelinedInitFile&                 initFile)
     {
         std::vector<int> aquifern(grid.getNumActive(), 0);
         // aquifer cells
@@ -604,12 +671,12 @@ namespace {
             }
         }
 
-        initFile.write("AQUIFERN", aquifern);
+        initFile.write("AQUIFERN", std::move(aquifern));
     }
 
     void writeAnalyticalAquiferConnections(const Opm::AquiferConfig&          aquifer,
                                            const ::Opm::EclipseGrid&          grid,
-                                           ::Opm::EclIO::OutputStream::Init&  initFile)
+                                           PipelinedInitFile&                 initFile)
     {
         std::vector<int> aquifera(grid.getNumActive(), 0);
 
@@ -622,12 +689,12 @@ namespace {
             }
         }
 
-        initFile.write("AQUIFERA", aquifera);
+        initFile.write("AQUIFERA", std::move(aquifera));
     }
 
     void writeAquifers(const Opm::AquiferConfig&          aquifer,
                        const ::Opm::EclipseGrid&          grid,
-                       ::Opm::EclIO::OutputStream::Init&  initFile)
+                       PipelinedInitFile&                 initFile)
     {
         if (aquifer.hasNumericalAquifer()) {
             writeNumericalAquifers(aquifer.numericalAquifers(), grid, initFile);
@@ -645,10 +712,12 @@ void Opm::InitIO::write(const ::Opm::EclipseState&              es,
                         const ::Opm::data::Solution&            simProps,
                         std::map<std::string, std::vector<int>> int_data,
                         const std::vector<::Opm::NNCdata>&      nnc,
-                        ::Opm::EclIO::OutputStream::Init&       initFile)
+                        ::Opm::EclIO::OutputStream::Init&       initFileStream)
 {
     const auto& units = es.getUnits();
 
+    auto initFile = PipelinedInitFile { initFileStream };
+
     writeInitFileHeader(es, grid, schedule, initFile);
 
     // The PORV vector is a special case.  This particular vector always
@@ -693,4 +762,6 @@ void Opm::InitIO::write(const ::Opm::EclipseState&              es,
     if (es.aquifer().active()) {
         writeAquifers(es.aquifer(), grid, initFile);
     }
+
+    initFile.finish();
 }
@@ -22,6 +22,7 @@
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <filesystem>
 #include <iterator>
@@ -30,6 +31,55 @@
 using EclEntry = std::tuple<std::string, Opm::EclIO::eclArrType, long int>;
 using ParamEntry = std::tuple<std::string, Opm::EclIO::eclArrType>;
 
+namespace {
+
+enum class FilterOperator { Equal, Less, Greater, Between };
+
+FilterOperator filterOperator(const std::string& opperator)
+{
+    if ((opperator == "eq") || (opperator == "=="))
+        return FilterOperator::Equal;
+
+    if ((opperator == "lt") || (opperator == "<"))
+        return FilterOperator::Less;
+
+    if ((opperator == "gt") || (opperator == ">"))
+        return FilterOperator::Greater;
+
+    if ((opperator == "in") || (opperator == "between"))
+        return FilterOperator::Between;
+
+    const std::string message =
+        fmt::format("Unknown operator {} used to set filter", opperator);
+    throw std::invalid_argument(message);
+}
+
+// Deactivate all cells for which 'keep' is false.  The loop body is free of
+// branches so that the compiler is able to vectorise it.  Predicates are
+// written as negated rejection tests to keep the NaN handling unchanged.
+template <typename T, typename Predicate>
+void applyFilter(std::vector<char>& mask, const std::vector<T>& values, Predicate keep)
+{
+    const auto size = static_cast<std::int64_t>(std::min(mask.size(), values.size()));
+
+    #pragma omp parallel for schedule(static)
+    for (std::int64_t i = 0; i < size; i++)
+        mask[i] = mask[i] & static_cast<char>(keep(values[i]));
+}
+
+template <typename T>
+void copyActive(const std::vector<char>& mask, const std::vector<T>& values, std::vector<T>& filtered)
+{
+    filtered.clear();
+    filtered.reserve(std::count(mask.begin(), mask.end(), char{1}));
+
+    for (size_t i = 0; i < values.size(); i++)
+        if (mask[i])
+            filtered.push_back(values[i]);
+}
+
+} // Anonymous namespace
+
 
 EModel::EModel(const std::string& filename) :
     initfile(filename)
@@ -69,7 +119,7 @@ EModel::EModel(const std::string& filename) :
     J.reserve(nActive);
     K.reserve(nActive);
 
-    ActFilter.resize(nActive, true);
+    ActFilter.resize(nActive, 1);
 
     std::vector<float> porv_all = initfile.get<float>("PORV");
 
@@ -195,10 +245,11 @@ void EModel::get_cell_volumes_from_grid()
         throw std::runtime_error(message);
     }
 
-    CELLVOL.clear();
+    CELLVOL.resize(nActive);
 
-    for (size_t n = 0;n < nActive; n++)
-        CELLVOL.push_back(grid->getCellVolume(I[n]-1, J[n]-1, K[n]-1));
+    #pragma omp parallel for schedule(static)
+    for (std::int64_t n = 0; n < static_cast<std::int64_t>(nActive); n++)
+        CELLVOL[n] = grid->getCellVolume(I[n]-1, J[n]-1, K[n]-1);
 
     celVolCalculated = true;
 }
@@ -222,7 +273,7 @@ std::vector<ParamEntry> EModel::getListOfParameters() const
 
 int EModel::getNumberOfActiveCells()
 {
-    return std::count(ActFilter.begin(), ActFilter.end(), true);
+    return std::count(ActFilter.begin(), ActFilter.end(), char{1});
 }
 
 bool EModel::hasInitParameter(const std::string &name) const
@@ -255,31 +306,29 @@ bool EModel::hasReportStep(int rstep)
 void EModel::resetFilter()
 {
     activeFilter=false;
-    std::fill(ActFilter.begin(), ActFilter.end(), true);
+    std::fill(ActFilter.begin(), ActFilter.end(), 1);
 }
 
 
 template <typename T>
 void EModel::updateActiveFilter(const std::vector<T>& paramVect, const std::string& opperator, T value)
 {
-    if ((opperator == "eq") || (opperator == "==")){
-       for (size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && (paramVect[i] != value))
-                ActFilter[i] = false;
+    switch (filterOperator(opperator)) {
+    case FilterOperator::Equal:
+        applyFilter(ActFilter, paramVect, [value](const T x) { return !(x != value); });
+        break;
 
-    } else if ((opperator=="lt") || (opperator=="<")) {
-        for (size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && (paramVect[i] >= value))
-                ActFilter[i] = false;
+    case FilterOperator::Less:
+        applyFilter(ActFilter, paramVect, [value](const T x) { return !(x >= value); });
+        break;
 
-    } else if ((opperator == "gt") || (opperator == ">")){
-        for (size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && (paramVect[i] <= value))
-                ActFilter[i] = false;
+    case FilterOperator::Greater:
+        applyFilter(ActFilter, paramVect, [value](const T x) { return !(x <= value); });
+        break;
 
-    } else {
+    default:
         const std::string message =
-            fmt::format("Unknown operator {} used to set filter", opperator);
+            fmt::format("Operator {} used to set filter requires two values", opperator);
         throw std::invalid_argument(message);
     }
 
@@ -289,17 +338,15 @@ void EModel::updateActiveFilter(const std::vector<T>& paramVect, const std::stri
 template <typename T>
 void EModel::updateActiveFilter(const std::vector<T>& paramVect, const std::string& opperator, T value1, T value2)
 {
-    if ((opperator == "in") || (opperator == "between")) {
-        for (size_t i = 0; i < paramVect.size(); i++)
-            if ((ActFilter[i]) && ((paramVect[i] <= value1) || (paramVect[i] >= value2)))
-                ActFilter[i] = false;
-
-    } else {
+    if (filterOperator(opperator) != FilterOperator::Between) {
         const std::string message =
-            fmt::format("Unknown operator {} used to set filter", opperator);
+            fmt::format("Operator {} used to set filter requires one value", opperator);
         throw std::invalid_argument(message);
     }
 
+    applyFilter(ActFilter, paramVect,
+                [value1, value2](const T x) { return !((x <= value1) || (x >= value2)); });
+
     activeFilter = true;
 }
 
@@ -347,21 +394,21 @@ const std::vector<T>& EModel::get_filter_param(const std::string& param)
 template <>
 void EModel::addFilter<int>(const std::string& param1, const std::string& opperator, int num)
 {
-    std::vector<int> paramVect = get_filter_param<int>(param1);
+    const auto& paramVect = get_filter_param<int>(param1);
     updateActiveFilter(paramVect, opperator, num);
 }
 
 template <>
 void EModel::addFilter<int>(const std::string& param1, const std::string& opperator, int num1, int num2)
 {
-    std::vector<int> paramVect = get_filter_param<int>(param1);;
+    const auto& paramVect = get_filter_param<int>(param1);
     updateActiveFilter(paramVect, opperator, num1, num2);
 }
 
 template <>
 void EModel::addFilter<float>(const std::string& param1, const std::string& opperator, float num)
 {
-    std::vector<float> paramVect = get_filter_param<float>(param1);
+    const auto& paramVect = get_filter_param<float>(param1);
     updateActiveFilter(paramVect, opperator, num);
 }
 
@@ -369,7 +416,7 @@ void EModel::addFilter<float>(const std::string& param1, const std::string& oppe
 template <>
 void EModel::addFilter<float>(const std::string& param1, const std::string& opperator, float num1, float num2)
 {
-    std::vector<float> paramVect = get_filter_param<float>(param1);
+    const auto& paramVect = get_filter_param<float>(param1);
     updateActiveFilter(paramVect, opperator, num1, num2);
 }
 
@@ -381,16 +428,16 @@ void EModel::addHCvolFilter()
                                  "function setDepthfwl before using "
                                  "filter HC filter");
 
-    auto eqlnum = initfile.get<int>("EQLNUM");
-    auto depth = initfile.get<float>("DEPTH");
+    const auto& eqlnum = initfile.get<int>("EQLNUM");
+    const auto& depth = initfile.get<float>("DEPTH");
     activeFilter = true;
 
-    for (size_t n = 0; n < eqlnum.size();n++){
-        int eql = eqlnum[n];
-        float fwl = FreeWaterlevel[eql-1];
+    const auto size = static_cast<std::int64_t>(std::min(eqlnum.size(), ActFilter.size()));
 
-        if ((ActFilter[n]) && (depth[n] > fwl))
-            ActFilter[n] = false;
+    #pragma omp parallel for schedule(static)
+    for (std::int64_t n = 0; n < size; n++){
+        const float fwl = FreeWaterlevel[eqlnum[n]-1];
+        ActFilter[n] = ActFilter[n] & static_cast<char>(!(depth[n] > fwl));
     }
 }
 
@@ -399,13 +446,7 @@ template <>
 const std::vector<float>& EModel::getParam<float>(const std::string& name)
 {
     if (activeFilter) {
-        std::vector<float> param = get_filter_param<float>(name);
-        filteredFloatVect.clear();
-
-        for (size_t i = 0; i < param.size(); i++)
-            if (ActFilter[i])
-                filteredFloatVect.push_back(param[i]);
-
+        copyActive(ActFilter, get_filter_param<float>(name), filteredFloatVect);
         return filteredFloatVect;
 
     } else {
@@ -419,13 +460,7 @@ template <>
 const std::vector<int>& EModel::getParam<int>(const std::string& name)
 {
     if (activeFilter) {
-        std::vector<int> param = get_filter_param<int>(name);
-        filteredIntVect.clear();
-
-        for (size_t i = 0; i < param.size(); i++)
-            if (ActFilter[i])
-                filteredIntVect.push_back(param[i]);
-
+        copyActive(ActFilter, get_filter_param<int>(name), filteredIntVect);
         return filteredIntVect;
 
     } else {
@@ -83,7 +83,10 @@ private:
     std::vector<float> PORV;
     std::vector<float> CELLVOL;
     std::vector<int> I, J, K;
-    std::vector<bool> ActFilter;
+
+    // One byte per active cell rather than std::vector<bool>, such that the
+    // filter loops can be vectorised and run in parallel.
+    std::vector<char> ActFilter;
 
     Opm::EclIO::EclFile initfile;
     std::optional<Opm::EclipseGrid> grid;
@@ -2,6 +2,9 @@
 #define SUNBEAM_CONVERTERS_HPP
 
 #include <sstream>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
 
@@ -48,6 +51,36 @@ py::array_t<T> numpy_array(const std::vector<T>& input) {
     return output;
 }
 
+/*
+  Hand a temporary vector over to NumPy without copying the elements; the
+  returned array takes ownership of the vector.
+*/
+template <class T, std::enable_if_t<!std::is_same_v<T, bool>, int> = 0>
+py::array_t<T> numpy_array(std::vector<T>&& input) {
+    auto* data = new std::vector<T>(std::move(input));
+    py::capsule owner(data, [](void* ptr) { delete static_cast<std::vector<T>*>(ptr); });
+
+    return py::array_t<T>(data->size(), data->data(), owner);
+}
+
+/*
+  Read-only NumPy view of a vector stored in the C++ object wrapped by the
+  Python object 'owner'. The view keeps 'owner' alive, and must only be used
+  for vectors which are never reallocated while 'owner' exists.
+*/
+template <class T>
+py::array_t<T> numpy_view(const std::vector<T>& input, py::handle owner) {
+    if constexpr (std::is_same_v<T, bool>) {
+        // std::vector<bool> is not contiguous storage.
+        return numpy_array(input);
+    } else {
+        auto output = py::array_t<T>(input.size(), input.data(), owner);
+        output.attr("flags").attr("writeable") = false;
+
+        return output;
+    }
+}
+
 }
 
 #endif //SUNBEAM_CONVERTERS_HPP
@@ -15,8 +15,6 @@
 #include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
-#include <opm/common/utility/numeric/calculateCellVol.hpp>
-
 #include "export.hpp"
 #include "converters.hpp"
 
@@ -70,12 +68,14 @@ public:
             return m_ext_esmry->numberOfTimeSteps();
     }
 
-    py::array get_smry_vector(const std::string& key)
+    // The summary vectors are not modified once loaded, so they are
+    // returned as read-only views owned by 'self'.
+    py::array get_smry_vector(const std::string& key, py::handle self)
     {
         if (m_esmry != nullptr)
-            return convert::numpy_array( m_esmry->get(key) );
+            return convert::numpy_view( m_esmry->get(key), self );
         else
-            return convert::numpy_array( m_ext_esmry->get(key) );
+            return convert::numpy_view( m_ext_esmry->get(key), self );
     }
 
     py::array get_smry_vector_at_rsteps(const std::string& key)
@@ -203,21 +203,24 @@ private:
 };
 
 
-npArray get_vector_index(Opm::EclIO::EclFile * file_ptr, std::size_t array_index)
+// Arrays loaded by EclFile are never reread or modified, so numeric arrays
+// are returned as read-only views owned by the Python EclFile object 'self'.
+npArray get_vector_index(py::object self, std::size_t array_index)
 {
+    auto* file_ptr = self.cast<Opm::EclIO::EclFile*>();
     auto array_type = std::get<1>(file_ptr->getList()[array_index]);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<int>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<int>(array_index), self ), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<float>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<float>(array_index), self ), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<double>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<double>(array_index), self ), array_type);
 
     if (array_type == Opm::EclIO::LOGI)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<bool>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<bool>(array_index), self ), array_type);
 
     if ((array_type == Opm::EclIO::CHAR) || (array_type == Opm::EclIO::C0NN))
         return std::make_tuple (convert::numpy_string_array( file_ptr->get<std::string>(array_index)), array_type);
@@ -241,26 +244,30 @@ size_t get_array_index(const std::vector<EclEntry>& array_list, const std::strin
     return std::distance(array_list.begin(), it);
 }
 
-npArray get_vector_name(Opm::EclIO::EclFile * file_ptr, const std::string& array_name)
+npArray get_vector_name(py::object self, const std::string& array_name)
 {
+    auto* file_ptr = self.cast<Opm::EclIO::EclFile*>();
+
     if (file_ptr->hasKey(array_name) == false)
         throw std::logic_error("Array " + array_name + " not found in EclFile");
 
     auto array_list = file_ptr->getList();
     size_t array_index = get_array_index(array_list, array_name, 0);
 
-    return get_vector_index(file_ptr, array_index);
+    return get_vector_index(self, array_index);
 }
 
-npArray get_vector_occurrence(Opm::EclIO::EclFile * file_ptr, const std::string& array_name, size_t occurrence)
+npArray get_vector_occurrence(py::object self, const std::string& array_name, size_t occurrence)
 {
+    auto* file_ptr = self.cast<Opm::EclIO::EclFile*>();
+
     if (occurrence >= file_ptr->count(array_name) )
         throw std::logic_error("Occurrence " + std::to_string(occurrence) + " not found in EclFile");
 
     auto array_list = file_ptr->getList();
     size_t array_index = get_array_index(array_list, array_name, occurrence);
 
-    return get_vector_index(file_ptr, array_index);
+    return get_vector_index(self, array_index);
 }
 
 bool erst_contains(Opm::EclIO::ERst * file_ptr, std::tuple<std::string, int> keyword)
@@ -269,8 +276,10 @@ bool erst_contains(Opm::EclIO::ERst * file_ptr, std::tuple<std::string, int> key
     return hasKeyAtReport;
 }
 
-npArray get_erst_by_index(Opm::EclIO::ERst * file_ptr, size_t index, size_t rstep)
+npArray get_erst_by_index(py::object self, size_t index, size_t rstep)
 {
+    auto* file_ptr = self.cast<Opm::EclIO::ERst*>();
+
     auto arrList = file_ptr->listOfRstArrays(rstep);
 
     if (index >=arrList.size())
@@ -279,16 +288,16 @@ npArray get_erst_by_index(Opm::EclIO::ERst * file_ptr, size_t index, size_t rste
     auto array_type = std::get<1>(arrList[index]);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<int>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<int>(index, rstep), self ), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<float>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<float>(index, rstep), self ), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<double>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<double>(index, rstep), self ), array_type);
 
     if (array_type == Opm::EclIO::LOGI)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<bool>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<bool>(index, rstep), self ), array_type);
 
     if (array_type == Opm::EclIO::CHAR)
         return std::make_tuple (convert::numpy_string_array( file_ptr->getRestartData<std::string>(index, rstep)), array_type);
@@ -297,8 +306,10 @@ npArray get_erst_by_index(Opm::EclIO::ERst * file_ptr, size_t index, size_t rste
 }
 
 
-npArray get_erst_vector(Opm::EclIO::ERst * file_ptr, const std::string& key, size_t rstep, size_t occurrence)
+npArray get_erst_vector(py::object self, const std::string& key, size_t rstep, size_t occurrence)
 {
+    auto* file_ptr = self.cast<Opm::EclIO::ERst*>();
+
     if (occurrence >= static_cast<size_t>(file_ptr->occurrence_count(key, rstep)))
         throw std::out_of_range("file have less than " + std::to_string(occurrence + 1) + " arrays in selected report step");
 
@@ -306,7 +317,7 @@ npArray get_erst_vector(Opm::EclIO::ERst * file_ptr, const std::string& key, siz
 
     size_t array_index = get_array_index(array_list, key, occurrence);
 
-    return get_erst_by_index(file_ptr, array_index, rstep);
+    return get_erst_by_index(self, array_index, rstep);
 }
 
 std::tuple<std::array<double,8>, std::array<double,8>, std::array<double,8>>
@@ -364,18 +375,19 @@ py::array get_cellvolumes_mask(Opm::EclIO::EGrid * file_ptr, std::vector<int> ma
     if (totCells != mask.size())
         throw std::logic_error("size of input mask doesn't match size of grid");
 
-    std::array<double,8> X = {0.0};
-    std::array<double,8> Y = {0.0};
-    std::array<double,8> Z = {0.0};
-
+    std::vector<int> cells;
     for (size_t globInd = 0; globInd < totCells; globInd++){
-        if (mask[globInd] > 0){
-            file_ptr->getCellCorners(globInd, X, Y, Z);
-            celvol[globInd] = calculateCellVol(X, Y, Z);
-        }
+        if (mask[globInd] > 0)
+            cells.push_back(globInd);
     }
 
-    return convert::numpy_array( celvol );
+    std::vector<double> volumes;
+    file_ptr->getCellVolumes(cells, volumes);
+
+    for (size_t n = 0; n < cells.size(); n++)
+        celvol[cells[n]] = volumes[n];
+
+    return convert::numpy_array( std::move(celvol) );
 }
 
 py::array get_cellvolumes(Opm::EclIO::EGrid * file_ptr)
@@ -497,7 +509,9 @@ void python::common::export_IO(py::module& m) {
         .def("__contains__", &ESmryBind::hasKey, py::arg("key"), ESmry_contains_docstring)
         .def("make_esmry_file", &ESmryBind::make_esmry_file, ESmry_make_esmry_file_docstring)
         .def("__len__", &ESmryBind::numberOfTimeSteps, ESmry_len_docstring)
-        .def("__get_all", &ESmryBind::get_smry_vector, py::arg("key"), ESmry_get_all_docstring)
+        .def("__get_all", [](py::object self, const std::string& key)
+             { return self.cast<ESmryBind&>().get_smry_vector(key, self); },
+             py::arg("key"), ESmry_get_all_docstring)
         .def("__get_at_rstep", &ESmryBind::get_smry_vector_at_rsteps, py::arg("key"), ESmry_get_at_rstep_docstring)
         .def("__start_date", &ESmryBind::smry_start_date, ESmry_start_date_docstring)
         .def("keys", (const std::vector<std::string>& (ESmryBind::*) (void) const)
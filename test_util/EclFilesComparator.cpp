@@ -36,7 +36,7 @@
     if (throwOnError) \
       OPM_THROW(type, message); \
     else { \
-      std::cerr << message << std::endl; \
+      *errorStream << message << std::endl; \
       ++num_errors; \
     } \
   }
@@ -61,7 +61,7 @@ printValuesForCell(const std::string& keyword,
 
             ijk[0]++, ijk[1]++, ijk[2]++;
 
-            std::cout << std::endl
+            *reportStream << std::endl
                       << "\nKeyword: " << keyword << ", origin "  << reference << "\n"
                       << "Global index (zero based)   = "  << cell << "\n"
                       << "Grid coordinate             = (" << ijk[0] << ", " << ijk[1] << ", " << ijk[2] << ")" << "\n"
@@ -75,7 +75,7 @@ printValuesForCell(const std::string& keyword,
 
             ijk[0]++, ijk[1]++, ijk[2]++;
 
-            std::cout << std::endl
+            *reportStream << std::endl
                       << "\nKeyword: " << keyword << ", origin "  << reference << "\n\n"
                       << "Global index (zero based)   = "  << cell << "\n"
                       << "Grid coordinate             = (" << ijk[0] << ", " << ijk[1] << ", " << ijk[2] << ")" << "\n"
@@ -84,7 +84,7 @@ printValuesForCell(const std::string& keyword,
         }
     }
 
-    std::cout << std::endl
+    *reportStream << std::endl
               << "\nKeyword: " << keyword << ", origin "  << reference << "\n\n"
               << "Value index                 = "  << cell << "\n"
               << "(first value, second value) = (" << value1 << ", " << value2 << ")\n\n";
@@ -22,6 +22,7 @@
 
 #include "Deviation.hpp"
 
+#include <iostream>
 #include <map>
 #include <stddef.h>
 #include <string>
@@ -74,6 +75,10 @@ protected:
     std::map<std::string, std::vector<Deviation>> deviations;
     mutable size_t num_errors = 0;
 
+    //! Streams receiving the comparison report and the error messages.
+    std::ostream* reportStream = &std::cout;
+    std::ostream* errorStream = &std::cerr;
+
     std::string rootName1, rootName2;
 
     template <typename T>
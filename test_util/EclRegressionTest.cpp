@@ -34,16 +34,25 @@
 #include <opm/common/utility/numeric/cmp.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstdint>
+#include <exception>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <set>
+#include <sstream>
 #include <typeinfo>
 #include <unordered_set>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 // helper macro to handle error throws or not
 #define HANDLE_ERROR(type, message)                     \
     do {                                                \
@@ -51,7 +60,7 @@
             OPM_THROW((type), (message));               \
         }                                               \
         else {                                          \
-            std::cerr << (message) << std::endl;        \
+            *errorStream << (message) << std::endl;     \
             ++this->num_errors;                         \
         }                                               \
     } while (false)
@@ -62,7 +71,7 @@
             OPM_THROW((type), (message));               \
         }                                               \
         else {                                          \
-            std::cerr << (message) << std::endl;        \
+            *errorStream << (message) << std::endl;     \
             ++this->num_errors;                         \
             return;                                     \
         }                                               \
@@ -80,13 +89,6 @@ std::vector<T> sorted(std::vector<T> v) {
 
 using namespace Opm::EclIO;
 
-ECLRegressionTest::~ECLRegressionTest()
-{
-    delete grid1;
-    delete grid2;
-}
-
-
 static bool fileExists(const std::string& fileName) {
     std::ifstream f(fileName);
     return f.good();
@@ -137,6 +139,29 @@ void ECLRegressionTest::compareFloatingPointVectors(const std::vector<T>& t1, co
     it = std::find(keywordsStrictTol.begin(), keywordsStrictTol.end(), keyword);
     bool strictTol = it != keywordsStrictTol.end() ? true : false;
 
+    // Most arrays match within the tolerances. Check this first with a
+    // tight loop, and only fall back to the cell by cell analysis below,
+    // which reports the deviations, if some values do not match.
+    if (allowNegatives) {
+        const double absToleranceLoc = strictTol ? strictAbsTol : getAbsTolerance();
+        const double relToleranceLoc = strictTol ? strictAbsTol : getRelTolerance();
+
+        const auto withinTolerance = [absToleranceLoc, relToleranceLoc](const T v1, const T v2)
+        {
+            const double val1 = v1;
+            const double val2 = v2;
+            const double absDev = std::abs(val1 - val2);
+
+            return (absDev <= absToleranceLoc)
+                || ((val1 != 0) && (val2 != 0) &&
+                    (absDev / std::max(std::abs(val1), std::abs(val2)) <= relToleranceLoc));
+        };
+
+        if (std::equal(t1.begin(), t1.end(), t2.begin(), withinTolerance)) {
+            return;
+        }
+    }
+
     for (size_t i = 0; i < t1.size(); i++) {
         deviationsForCell(static_cast<double>(t1[i]),
                           static_cast<double>(t2[i]),
@@ -179,7 +204,7 @@ template <typename T>
 void ECLRegressionTest::deviationsForNonFloatingPoints(T val1, T val2, const std::string& keyword, const std::string& reference, size_t kw_size, size_t cell)
 {
     if (val1 != val2) {
-        printValuesForCell(keyword, reference, kw_size, cell, grid1, val1, val2);
+        printValuesForCell(keyword, reference, kw_size, cell, grid1.get(), val1, val2);
         HANDLE_ERROR(std::runtime_error, "Non floating point values not identical ");
     }
 }
@@ -193,7 +218,7 @@ void ECLRegressionTest::deviationsForCell(double val1, double val2, const std::s
     if (!allowNegativeValues) {
         if (val1 < 0) {
             if (std::abs(val1) > absToleranceLoc) {
-                printValuesForCell(keyword, reference, kw_size, cell, grid1, val1, val2);
+                printValuesForCell(keyword, reference, kw_size, cell, grid1.get(), val1, val2);
                 HANDLE_ERROR(std::runtime_error,
                              fmt::format("Negative value in first file which in absolute value "
                                           "exceeds the absolute tolerance of {}.", absToleranceLoc));
@@ -203,7 +228,7 @@ void ECLRegressionTest::deviationsForCell(double val1, double val2, const std::s
 
         if (val2 < 0) {
             if (std::abs(val2) > absToleranceLoc) {
-                printValuesForCell(keyword, reference, kw_size, cell, grid1, val1, val2);
+                printValuesForCell(keyword, reference, kw_size, cell, grid1.get(), val1, val2);
                 HANDLE_ERROR(std::runtime_error,
                              fmt::format("Negative value in second file which in absolute value "
                                          "exceeds the absolute tolerance of {}.", absToleranceLoc));
@@ -218,10 +243,10 @@ void ECLRegressionTest::deviationsForCell(double val1, double val2, const std::s
             std::string keywref = keyword + ": " + reference;
             deviations[keywref].push_back(dev);
         } else {
-            printValuesForCell(keyword, reference, kw_size, cell, grid1, val1, val2);
+            printValuesForCell(keyword, reference, kw_size, cell, grid1.get(), val1, val2);
 
             if (useStrictTol) {
-                std::cout << "Keyword: " << keyword << " requires strict tolerances.\n" << std::endl;
+                *reportStream << "Keyword: " << keyword << " requires strict tolerances.\n" << std::endl;
             }
 
             HANDLE_ERROR(std::runtime_error,
@@ -234,26 +259,18 @@ void ECLRegressionTest::deviationsForCell(double val1, double val2, const std::s
                                      dev.rel, relToleranceLoc));
         }
     }
-
-    if (dev.abs != -1) {
-        absDeviation.push_back(dev.abs);
-    }
-
-    if (dev.rel != -1) {
-        relDeviation.push_back(dev.rel);
-    }
 }
 
 
 void ECLRegressionTest::printDeviationReport()
 {
     if (analysis) {
-        std::cout << " \n" << deviations.size() << " keyword"
+        *reportStream << " \n" << deviations.size() << " keyword"
                   << (deviations.size() > 1 ? "s":"") << " exhibit failures" << std::endl;
         for (const auto& iter : deviations) {
-            std::cout << "\t" << iter.first << std::endl;
-            std::cout << "\t\tFails for " << iter.second.size() << " entries" << std::endl;
-            std::cout.precision(7);
+            *reportStream << "\t" << iter.first << std::endl;
+            *reportStream << "\t\tFails for " << iter.second.size() << " entries" << std::endl;
+            reportStream->precision(7);
             double absErr = std::max_element(iter.second.begin(), iter.second.end(),
                                              [](const Deviation& a, const Deviation& b)
             {
@@ -264,9 +281,9 @@ void ECLRegressionTest::printDeviationReport()
             {
                 return a.rel < b.rel;
             })->rel;
-            std::cout << "\t\tLargest absolute error: "
+            *reportStream << "\t\tLargest absolute error: "
                       <<  std::scientific << absErr << std::endl;
-            std::cout << "\t\tLargest relative error: "
+            *reportStream << "\t\tLargest relative error: "
                       <<  std::scientific << relErr << std::endl;
         }
     }
@@ -277,7 +294,7 @@ void ECLRegressionTest::compareKeywords(const std::vector<std::string> &keywords
 
     if (!(acceptExtraKeywords or acceptExtraKeywordsBoth)) {
         if (keywords1 != keywords2) {
-            std::cout << "not same keywords in " << reference << std::endl;
+            *reportStream << "not same keywords in " << reference << std::endl;
 
             if (keywords1.size() > 50) {
                 printMissingKeywords(keywords1,keywords2);
@@ -293,7 +310,7 @@ void ECLRegressionTest::compareKeywords(const std::vector<std::string> &keywords
             auto it1 = std::find(keywords2.begin(), keywords2.end(), keyword);
             if (it1 == keywords2.end()) {
                 extraKeywordsFirstFile++;
-                std::cout << "Keyword " << keyword << " missing in second file " << std::endl;
+                *reportStream << "Keyword " << keyword << " missing in second file " << std::endl;
 
                 if (keywords1.size() > 50) {
                     printMissingKeywords(keywords1, keywords2);
@@ -308,12 +325,12 @@ void ECLRegressionTest::compareKeywords(const std::vector<std::string> &keywords
         }
 
         if (keywords2.size() > keywords1.size() - extraKeywordsFirstFile) {
-            std::cout << "\nExtra keywords ("
+            *reportStream << "\nExtra keywords ("
                       << std::to_string(keywords2.size() - keywords1.size() + extraKeywordsFirstFile)
                       << ") accepted in second file " << std::endl;
         }
         if (extraKeywordsFirstFile > 0) {
-            std::cout << "\nExtra keywords ("
+            *reportStream << "\nExtra keywords ("
                       << extraKeywordsFirstFile
                       << ") accepted in first file " << std::endl;
         }
@@ -335,7 +352,7 @@ void ECLRegressionTest::checkSpecificKeyword(std::vector<std::string>& keywords1
             fmt::format("Testing specific keyword \"{}\" in {}. "
                         "Keyword not found in any of the cases.",
                         specificKeyword, reference);
-        std::cout << msg << std::endl;
+        *reportStream << msg << std::endl;
         OPM_THROW(std::runtime_error, "\n" + msg);
     }
 
@@ -348,7 +365,7 @@ void ECLRegressionTest::checkSpecificKeyword(std::vector<std::string>& keywords1
                 fmt::format("Testing specific keyword in {}. "
                             "Keyword found in first case but "
                             "not in second case.", reference);
-            std::cout << msg << std::endl;
+            *reportStream << msg << std::endl;
             OPM_THROW(std::runtime_error, "\n" + msg);
         }
 
@@ -367,7 +384,7 @@ void ECLRegressionTest::checkSpecificKeyword(std::vector<std::string>& keywords1
                 fmt::format("Testing specific keyword in {}. "
                             "Keyword not found in first case but "
                             "found in second case.", reference);
-            std::cout << msg << std::endl;
+            *reportStream << msg << std::endl;
             OPM_THROW(std::runtime_error, "\n "+ msg);
         }
 
@@ -389,20 +406,20 @@ void ECLRegressionTest::loadGrids()
     foundEGrid2 = checkFileName(rootName2, "EGRID", fileName2);
 
     if (foundEGrid1) {
-        std::cout << "\nLoading EGrid " << fileName1 << "  .... ";
-        grid1 = new EGrid(fileName1);
-        std::cout << " done." << std::endl;
+        *reportStream << "\nLoading EGrid " << fileName1 << "  .... ";
+        grid1 = std::make_shared<EGrid>(fileName1);
+        *reportStream << " done." << std::endl;
     }
 
     if (foundEGrid2) {
-        std::cout << "Loading EGrid " << fileName2 << "  .... ";
-        grid2 = new EGrid(fileName2);
-        std::cout << " done." << std::endl;
+        *reportStream << "Loading EGrid " << fileName2 << "  .... ";
+        grid2 = std::make_shared<EGrid>(fileName2);
+        *reportStream << " done." << std::endl;
     }
 
     if ((not foundEGrid1) || (not foundEGrid2)) {
-        std::cout << "\nWarning! Both grids could not be loaded. Not possible to reference cell values to grid indices." << std::endl;
-        std::cout << "Grid compare may also fail. SMRY, RFT, UNRST and INIT files can be checked \n" << std::endl;
+        *reportStream << "\nWarning! Both grids could not be loaded. Not possible to reference cell values to grid indices." << std::endl;
+        *reportStream << "Grid compare may also fail. SMRY, RFT, UNRST and INIT files can be checked \n" << std::endl;
     }
 }
 
@@ -413,13 +430,13 @@ void ECLRegressionTest::gridCompare()
 
     if ((grid1) && (not grid2)){
         std::string message ="test case egrid file " + rootName2 + ".EGRID could not be loaded";
-	std::cout << message << std::endl;
+	*reportStream << message << std::endl;
         OPM_THROW(std::runtime_error, message);
     }
 
     if (grid1 && grid2) {
 
-        std::cout << "comparing grids " << std::endl;
+        *reportStream << "comparing grids " << std::endl;
 
         const auto& dim1 = grid1->dimension();
         const auto& dim2 = grid2->dimension();
@@ -449,9 +466,9 @@ void ECLRegressionTest::gridCompare()
             return;
         }
 
-        std::cout << "\nComparing egrid files \n" << std::endl;
+        *reportStream << "\nComparing egrid files \n" << std::endl;
 
-        std::cout << "Dimensions             " << " ... ";
+        *reportStream << "Dimensions             " << " ... ";
 
         if (dim1[0] != dim2[0]  || dim1[1] != dim2[1] || dim1[2] != dim2[2]) {
             OPM_THROW(std::runtime_error,
@@ -462,9 +479,9 @@ void ECLRegressionTest::gridCompare()
                                   dim2[0], dim2[1], dim2[2]));
         }
 
-        std::cout << " done." << std::endl;
+        *reportStream << " done." << std::endl;
 
-        std::cout << "Active cells           " << " ... ";
+        *reportStream << "Active cells           " << " ... ";
 
         for (int k = 0; k < dim1[2]; k++) {
             for (int j=0; j < dim1[1]; j++) {
@@ -479,71 +496,69 @@ void ECLRegressionTest::gridCompare()
             }
         }
 
-        std::cout << " done." << std::endl;
-
-        std::cout << "X, Y and Z coordinates " << " ... ";
+        *reportStream << " done." << std::endl;
 
-        std::array<double,8> X1 = {0.0};
-        std::array<double,8> Y1 = {0.0};
-        std::array<double,8> Z1 = {0.0};
+        *reportStream << "X, Y and Z coordinates " << " ... ";
 
-        std::array<double,8> X2 = {0.0};
-        std::array<double,8> Y2 = {0.0};
-        std::array<double,8> Z2 = {0.0};
+        // Corners are computed in bulk, one layer at a time to bound memory use.
+        std::vector<std::array<double,8>> X1, Y1, Z1;
+        std::vector<std::array<double,8>> X2, Y2, Z2;
 
         for (int k = 0; k < dim1[2]; k++) {
-            for (int j = 0; j < dim1[1]; j++) {
-                for (int i = 0; i < dim1[0]; i++) {
-                    if (grid1->active_index(i,j,k) > -1) {
-                        grid1->getCellCorners({i,j,k}, X1, Y1, Z1);
-                        grid2->getCellCorners({i,j,k}, X2, Y2, Z2);
-
-                        for (int n = 0; n < 8; n++) {
-                            Deviation devX = calculateDeviations(X1[n], X2[n]);
-                            Deviation devY = calculateDeviations(Y1[n], Y2[n]);
-                            Deviation devZ = calculateDeviations(Z1[n], Z2[n]);
-
-                            if (devX.abs > strictAbsTol) {
-                                if (analysis) {
-                                    deviations["xcoordinate"].push_back(devX);
-                                } else {
-                                    OPM_THROW(std::runtime_error,
-                                              fmt::format("\nGrid1 and grid2 have different X coordinates. "
-                                                          "First difference found for cell i={} j={} k={}",
-                                                          i+1, j+1, k+1));
-                                }
-                            }
-
-                            if (devY.abs > strictAbsTol) {
-                                if (analysis) {
-                                    deviations["ycoordinate"].push_back(devY);
-                                } else {
-                                    OPM_THROW(std::runtime_error,
-                                              fmt::format("\nGrid1 and grid2 have different Y coordinates. "
-                                                          "First difference found for cell i={} j={} k={}",
-                                                          i+1, j+1, k+1));
-                                }
-                            }
-
-                            if (devZ.abs > strictAbsTol) {
-                                if (analysis) {
-                                    deviations["zcoordinate"].push_back(devZ);
-                                } else {
-                                    OPM_THROW(std::runtime_error,
-                                              fmt::format("\nGrid1 and grid2 have different Z coordinates. "
-                                                          "First difference found for cell i={} j={} k={}",
-                                                          i+1, j+1, k+1));
-                                }
-                            }
+            const auto cells = grid1->layerCells(k, k, true);
+
+            grid1->getCellCorners(cells, X1, Y1, Z1);
+            grid2->getCellCorners(cells, X2, Y2, Z2);
+
+            for (std::size_t c = 0; c < cells.size(); c++) {
+                const auto ijk = grid1->ijk_from_global_index(cells[c]);
+                const int i = ijk[0];
+                const int j = ijk[1];
+
+                for (int n = 0; n < 8; n++) {
+                    Deviation devX = calculateDeviations(X1[c][n], X2[c][n]);
+                    Deviation devY = calculateDeviations(Y1[c][n], Y2[c][n]);
+                    Deviation devZ = calculateDeviations(Z1[c][n], Z2[c][n]);
+
+                    if (devX.abs > strictAbsTol) {
+                        if (analysis) {
+                            deviations["xcoordinate"].push_back(devX);
+                        } else {
+                            OPM_THROW(std::runtime_error,
+                                      fmt::format("\nGrid1 and grid2 have different X coordinates. "
+                                                  "First difference found for cell i={} j={} k={}",
+                                                  i+1, j+1, k+1));
+                        }
+                    }
+
+                    if (devY.abs > strictAbsTol) {
+                        if (analysis) {
+                            deviations["ycoordinate"].push_back(devY);
+                        } else {
+                            OPM_THROW(std::runtime_error,
+                                      fmt::format("\nGrid1 and grid2 have different Y coordinates. "
+                                                  "First difference found for cell i={} j={} k={}",
+                                                  i+1, j+1, k+1));
+                        }
+                    }
+
+                    if (devZ.abs > strictAbsTol) {
+                        if (analysis) {
+                            deviations["zcoordinate"].push_back(devZ);
+                        } else {
+                            OPM_THROW(std::runtime_error,
+                                      fmt::format("\nGrid1 and grid2 have different Z coordinates. "
+                                                  "First difference found for cell i={} j={} k={}",
+                                                  i+1, j+1, k+1));
                         }
                     }
                 }
             }
         }
 
-        std::cout << " done." << std::endl;
+        *reportStream << " done." << std::endl;
 
-        std::cout << "NNC indices            " << " ... ";
+        *reportStream << "NNC indices            " << " ... ";
 
         // check / compare NNC definitions
 
@@ -567,32 +582,32 @@ void ECLRegressionTest::gridCompare()
 
             for (size_t n = 0; n < NNC11.size(); n++) {
                 if (NNC11[n] != NNC12[n] || NNC21[n] != NNC22[n]) {
-                    std::cout << "Differences in NNCs. First found for " << NNC11[n] << " -> " <<  NNC21[n];
-                    std::cout << " not same as " << NNC12[n] << " -> " <<  NNC22[n] << std::endl;
+                    *reportStream << "Differences in NNCs. First found for " << NNC11[n] << " -> " <<  NNC21[n];
+                    *reportStream << " not same as " << NNC12[n] << " -> " <<  NNC22[n] << std::endl;
 
                     auto ijk1 = grid1->ijk_from_global_index(NNC11[n]-1);
                     auto ijk2  = grid1->ijk_from_global_index(NNC21[n]-1);
 
-                    std::cout << "In grid1 " << ijk1[0]+1 << "," << ijk1[1]+1 <<"," << ijk1[2]+1  << " -> " << ijk2[0]+1 << "," << ijk2[1]+1 <<"," << ijk2[2]+1 << std::endl;
+                    *reportStream << "In grid1 " << ijk1[0]+1 << "," << ijk1[1]+1 <<"," << ijk1[2]+1  << " -> " << ijk2[0]+1 << "," << ijk2[1]+1 <<"," << ijk2[2]+1 << std::endl;
 
                     ijk1 = grid2->ijk_from_global_index(NNC12[n]-1);
                     ijk2 = grid2->ijk_from_global_index(NNC22[n]-1);
 
-                    std::cout << "In grid2 " << ijk1[0]+1 << "," << ijk1[1]+1 <<"," << ijk1[2]+1  << " -> " << ijk2[0]+1 << "," << ijk2[1]+1 <<"," << ijk2[2]+1 << std::endl;
+                    *reportStream << "In grid2 " << ijk1[0]+1 << "," << ijk1[1]+1 <<"," << ijk1[2]+1  << " -> " << ijk2[0]+1 << "," << ijk2[1]+1 <<"," << ijk2[2]+1 << std::endl;
 
                     OPM_THROW(std::runtime_error, "\n Grid1 and grid2 have different definitions of NNCs. ");
                 }
             }
         }
 
-        std::cout << " done." << std::endl;
+        *reportStream << " done." << std::endl;
 
         if (!deviations.empty()) {
             printDeviationReport();
         }
 
     } else {
-        std::cout << "\n!Warning, grid files not found, hence not compared. \n" << std::endl;
+        *reportStream << "\n!Warning, grid files not found, hence not compared. \n" << std::endl;
     }
 
 }
@@ -607,16 +622,16 @@ void ECLRegressionTest::results_init()
 
     if ((foundInit1) && (not foundInit2)){
         std::string message ="test case init file " + rootName2 + ".INIT not found";
-	std::cout << message << std::endl;
+	*reportStream << message << std::endl;
         OPM_THROW(std::runtime_error, message);
     }
 
     if (foundInit1 && foundInit2) {
         EclFile init1(fileName1);
-        std::cout << "\nLoading INIT file " << fileName1 << "  .... done" << std::endl;
+        *reportStream << "\nLoading INIT file " << fileName1 << "  .... done" << std::endl;
 
         EclFile init2(fileName2);
-        std::cout << "Loading INIT file " << fileName2 << "  .... done\n" << std::endl;
+        *reportStream << "Loading INIT file " << fileName2 << "  .... done\n" << std::endl;
 
         deviations.clear();
 
@@ -645,7 +660,7 @@ void ECLRegressionTest::results_init()
         if (printKeywordOnly) {
             printComparisonForKeywordLists(keywords1,keywords2, arrayType1, arrayType2);
         } else {
-            std::cout << "\nComparing init files \n" << std::endl;
+            *reportStream << "\nComparing init files \n" << std::endl;
             std::string reference = "Init file";
 
             if (specificKeyword.empty()) {
@@ -659,7 +674,7 @@ void ECLRegressionTest::results_init()
                     auto kw1 = sorted(keywords1);
                     auto kw2 = sorted(keywords2);
                     compareKeywords(kw1,kw2,reference);
-                    std::cerr << "Keyword reordering detected in INIT file" << std::endl;
+                    *errorStream << "Keyword reordering detected in INIT file" << std::endl;
                     /*
                       The keyword reordering should eventually be marked as a an
                       error, but temporarily during the refactoring of 3D
@@ -692,9 +707,9 @@ void ECLRegressionTest::results_init()
                 auto it = std::find(keywordsBlackList.begin(), keywordsBlackList.end(), keywords1[i]);
 
                 if (it != keywordsBlackList.end()){
-                    std::cout << "Skipping  " << keywords1[i] << std::endl;
+                    *reportStream << "Skipping  " << keywords1[i] << std::endl;
                 } else {
-                    std::cout << "Comparing " << keywords1[i] << " ... ";
+                    *reportStream << "Comparing " << keywords1[i] << " ... ";
 
                     if (arrayType1[i] == INTE) {
                         auto vect1 = init1.get<int>(keywords1[i]);
@@ -719,11 +734,11 @@ void ECLRegressionTest::results_init()
                     } else if (arrayType1[i] == MESS) {
                         // shold not be any associated data
                     } else {
-                        std::cout << "unknown array type " << std::endl;
+                        *reportStream << "unknown array type " << std::endl;
                         exit(1);
                     }
 
-                    std::cout << " done." << std::endl;
+                    *reportStream << " done." << std::endl;
                 }
             }
 
@@ -732,12 +747,141 @@ void ECLRegressionTest::results_init()
             }
         }
     } else {
-        std::cout << "\n!Warning, init files not found, hence not compared. \n" << std::endl;
+        *reportStream << "\n!Warning, init files not found, hence not compared. \n" << std::endl;
     }
 
 }
 
 
+void ECLRegressionTest::compareRestartStep(ERst& rst1, ERst& rst2, int seqn)
+{
+    *reportStream << "\nUnified restart files, sequence  " << std::to_string(seqn) << "\n" << std::endl;
+
+    std::string reference = "Restart, sequence "+std::to_string(seqn);
+
+    rst1.loadReportStepNumber(seqn);
+    rst2.loadReportStepNumber(seqn);
+
+    auto arrays1 = rst1.listOfRstArrays(seqn);
+    auto arrays2 = rst2.listOfRstArrays(seqn);
+
+    std::vector<std::string> keywords1;
+    std::vector<eclArrType> arrayType1;
+    for (const auto& array : arrays1) {
+        keywords1.push_back(std::get<0>(array));
+        arrayType1.push_back(std::get<1>(array));
+    }
+
+    std::vector<std::string> keywords2;
+    std::vector<eclArrType> arrayType2;
+
+    for (const auto& array : arrays2) {
+        keywords2.push_back(std::get<0>(array));
+        arrayType2.push_back(std::get<1>(array));
+    }
+
+    if (integrationTest) {
+        std::vector<std::string> keywords;
+
+        for (size_t i = 0; i < keywords1.size(); i++) {
+            if (keywords1[i] == "PRESSURE" ||
+                keywords1[i] == "SWAT" ||
+                keywords1[i] =="SGAS") {
+                auto search2 = std::find(keywords2.begin(), keywords2.end(), keywords1[i]);
+                if (search2 != keywords2.end()) {
+                    keywords.push_back(keywords1[i]);
+                } else if (acceptExtraKeywordsBoth) {
+                    continue;
+                }
+            }
+        }
+
+        keywords1 = keywords2 = keywords;
+
+        int nKeys = keywords.size();
+        arrayType1.assign(nKeys, REAL);
+        arrayType2.assign(nKeys, REAL);
+    }
+
+    if (printKeywordOnly) {
+        printComparisonForKeywordLists(keywords1, keywords2, arrayType1, arrayType2);
+    } else {
+        if (specificKeyword.empty()) {
+            compareKeywords(keywords1, keywords2, reference);
+        } else {
+            checkSpecificKeyword(keywords1, keywords2, arrayType1, arrayType2, reference);
+        }
+
+        for (size_t i = 0; i < keywords1.size(); i++) {
+            //if (keywords.count(keywords1[i]) == 0)
+            //    continue;
+
+            auto it1 = std::find(keywords2.begin(), keywords2.end(), keywords1[i]);
+            if (it1 == keywords2.end() and acceptExtraKeywordsBoth) {
+                continue;
+            }
+            int ind2 = std::distance(keywords2.begin(), it1);
+
+            if (arrayType1[i] != arrayType2[ind2]) {
+                printComparisonForKeywordLists(keywords1, keywords2, arrayType1, arrayType2);
+                OPM_THROW(std::runtime_error,
+                          fmt::format("\nArray with same name '{}', "
+                                      "but of different type. "
+                                      "Restart file sequence {}",
+                                      keywords1[i], seqn));
+            }
+
+            auto it = std::find(keywordsBlackList.begin(), keywordsBlackList.end(), keywords1[i]);
+
+            if (it != keywordsBlackList.end()){
+                *reportStream << "Skipping  " << keywords1[i] << std::endl;
+            } else {
+
+                *reportStream << "Comparing " << keywords1[i] << " ... ";
+
+                if (arrayType1[i] == INTE) {
+                    const auto& vect1 = rst1.getRestartData<int>(keywords1[i], seqn, 0);
+                    const auto& vect2 = rst2.getRestartData<int>(keywords2[ind2], seqn, 0);
+                    compareVectors(vect1, vect2, keywords1[i], reference);
+                } else if (arrayType1[i] == REAL) {
+                    const auto& vect1 = rst1.getRestartData<float>(keywords1[i], seqn, 0);
+                    const auto& vect2 = rst2.getRestartData<float>(keywords2[ind2], seqn, 0);
+                    compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
+                } else if (arrayType1[i] == DOUB) {
+                    const auto& vect1 = rst1.getRestartData<double>(keywords1[i], seqn, 0);
+                    auto vect2 = rst2.getRestartData<double>(keywords2[ind2], seqn, 0);
+
+                    // hack in order to not test doubhead[1], dependent on simulation results
+                    // All ohter items in DOUBHEAD are tested with strict tolerances
+                    if (keywords1[i]=="DOUBHEAD"){
+                        vect2[1] = vect1[1];
+                    }
+                    compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
+                } else if (arrayType1[i] == LOGI) {
+                    const auto& vect1 = rst1.getRestartData<bool>(keywords1[i], seqn, 0);
+                    const auto& vect2 = rst2.getRestartData<bool>(keywords2[ind2], seqn, 0);
+                    compareVectors(vect1, vect2, keywords1[i], reference);
+                } else if (arrayType1[i] == CHAR) {
+                    const auto& vect1 = rst1.getRestartData<std::string>(keywords1[i], seqn, 0);
+                    const auto& vect2 = rst2.getRestartData<std::string>(keywords2[ind2], seqn, 0);
+                    compareVectors(vect1, vect2, keywords1[i], reference);
+                } else if (arrayType1[i] == MESS) {
+                    // shold not be any associated data
+                } else {
+                    *reportStream << "unknown array type " << std::endl;
+                    exit(1);
+                }
+
+                *reportStream << " done." << std::endl;
+            }
+        }
+    }
+
+    // Only keep one report step of each file in memory.
+    rst1.unloadReportStepNumber(seqn);
+    rst2.unloadReportStepNumber(seqn);
+}
+
 void ECLRegressionTest::results_rst()
 {
     std::string fileName1, fileName2;
@@ -746,16 +890,16 @@ void ECLRegressionTest::results_rst()
 
     if ((foundRst1) && (not foundRst2)){
         std::string message ="test case restart file " + rootName2 + ".UNRST not found";
-	std::cout << message << std::endl;
+	*reportStream << message << std::endl;
         OPM_THROW(std::runtime_error, message);
     }
 
     if (foundRst1 && foundRst2) {
         auto rst1 = std::make_shared<ERst>(fileName1);
-        std::cout << "\nLoading restart file " << fileName1 << "  .... done" << std::endl;
+        *reportStream << "\nLoading restart file " << fileName1 << "  .... done" << std::endl;
 
         auto rst2 = std::make_shared<ERst>(fileName2);
-        std::cout << "Loading restart file " << fileName2 << "  .... done\n" << std::endl;
+        *reportStream << "Loading restart file " << fileName2 << "  .... done\n" << std::endl;
 
         std::vector<int> seqnums1 = rst1->listOfReportStepNumbers();
         std::vector<int> seqnums2 = rst2->listOfReportStepNumbers();
@@ -811,140 +955,90 @@ void ECLRegressionTest::results_rst()
                            std::back_inserter(seqnStrList2),
                            [](const auto& val) { return std::to_string(val); });
 
-            std::cout << "\nrestart sequences " << std::endl;
+            *reportStream << "\nrestart sequences " << std::endl;
             printComparisonForKeywordLists(seqnStrList1, seqnStrList2);
             OPM_THROW(std::runtime_error, "\nRestart files not having the same report steps: ");
         }
 
-        for (int& seqn : seqnums1) {
-            std::cout << "\nUnified restart files, sequence  " << std::to_string(seqn) << "\n" << std::endl;
-
-            std::string reference = "Restart, sequence "+std::to_string(seqn);
-
-            rst1->loadReportStepNumber(seqn);
-            rst2->loadReportStepNumber(seqn);
-
-            auto arrays1 = rst1->listOfRstArrays(seqn);
-            auto arrays2 = rst2->listOfRstArrays(seqn);
-
-            std::vector<std::string> keywords1;
-            std::vector<eclArrType> arrayType1;
-            for (const auto& array : arrays1) {
-                keywords1.push_back(std::get<0>(array));
-                arrayType1.push_back(std::get<1>(array));
+        // The report steps are compared in parallel.  Each thread reads the
+        // restart files through its own ERst objects, and each step is
+        // compared by a copy of this object which buffers the report.  The
+        // buffers are written in report step order, so the output is the
+        // same as for a serial comparison.  No steps after the first
+        // failing one are reported, and its exception is rethrown once the
+        // preceding steps have been written.
+        const auto numSteps = static_cast<std::int64_t>(seqnums1.size());
+        std::atomic<std::int64_t> firstFailure { numSteps };
+        std::exception_ptr failure;
+
+        ECLRegressionTest prototype(*this);
+        prototype.deviations.clear();
+        prototype.num_errors = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            auto threadRst1 = rst1;
+            auto threadRst2 = rst2;
+#ifdef _OPENMP
+            if (omp_get_thread_num() > 0) {
+                threadRst1 = std::make_shared<ERst>(fileName1);
+                threadRst2 = std::make_shared<ERst>(fileName2);
             }
 
-            std::vector<std::string> keywords2;
-            std::vector<eclArrType> arrayType2;
+#pragma omp for ordered schedule(dynamic)
+#endif
+            for (std::int64_t step = 0; step < numSteps; ++step) {
+                std::ostringstream report;
+                std::ostringstream errors;
 
-            for (const auto& array : arrays2) {
-                keywords2.push_back(std::get<0>(array));
-                arrayType2.push_back(std::get<1>(array));
-            }
+                ECLRegressionTest stepTest(prototype);
+                stepTest.reportStream = &report;
+                stepTest.errorStream = &errors;
 
-            if (integrationTest) {
-                std::vector<std::string> keywords;
-
-                for (size_t i = 0; i < keywords1.size(); i++) {
-                    if (keywords1[i] == "PRESSURE" ||
-                        keywords1[i] == "SWAT" ||
-                        keywords1[i] =="SGAS") {
-                        auto search2 = std::find(keywords2.begin(), keywords2.end(), keywords1[i]);
-                        if (search2 != keywords2.end()) {
-                            keywords.push_back(keywords1[i]);
-                        } else if (acceptExtraKeywordsBoth) {
-                            continue;
-                        }
+                std::exception_ptr stepFailure;
+                if (step < firstFailure.load()) {
+                    try {
+                        stepTest.compareRestartStep(*threadRst1, *threadRst2, seqnums1[step]);
                     }
-                }
+                    catch (...) {
+                        stepFailure = std::current_exception();
 
-                keywords1 = keywords2 = keywords;
-
-                int nKeys = keywords.size();
-                arrayType1.assign(nKeys, REAL);
-                arrayType2.assign(nKeys, REAL);
-            }
-
-            if (printKeywordOnly) {
-                printComparisonForKeywordLists(keywords1, keywords2, arrayType1, arrayType2);
-            } else {
-                if (specificKeyword.empty()) {
-                    compareKeywords(keywords1, keywords2, reference);
-                } else {
-                    checkSpecificKeyword(keywords1, keywords2, arrayType1, arrayType2, reference);
+                        auto first = firstFailure.load();
+                        while ((step < first) &&
+                               !firstFailure.compare_exchange_weak(first, step))
+                        {}
+                    }
                 }
 
-                for (size_t i = 0; i < keywords1.size(); i++) {
-                    //if (keywords.count(keywords1[i]) == 0)
-                    //    continue;
-
-                    auto it1 = std::find(keywords2.begin(), keywords2.end(), keywords1[i]);
-                    if (it1 == keywords2.end() and acceptExtraKeywordsBoth) {
-                        continue;
-                    }
-                    int ind2 = std::distance(keywords2.begin(), it1);
+#ifdef _OPENMP
+#pragma omp ordered
+#endif
+                if (!failure) {
+                    *reportStream << report.str() << std::flush;
+                    *errorStream << errors.str() << std::flush;
 
-                    if (arrayType1[i] != arrayType2[ind2]) {
-                        printComparisonForKeywordLists(keywords1, keywords2, arrayType1, arrayType2);
-                        OPM_THROW(std::runtime_error,
-                                  fmt::format("\nArray with same name '{}', "
-                                              "but of different type. "
-                                              "Restart file sequence {}",
-                                              keywords1[i], seqn));
+                    for (auto& [keyword, deviation] : stepTest.deviations) {
+                        auto& dev = this->deviations[keyword];
+                        dev.insert(dev.end(), deviation.begin(), deviation.end());
                     }
 
-                    auto it = std::find(keywordsBlackList.begin(), keywordsBlackList.end(), keywords1[i]);
-
-                    if (it != keywordsBlackList.end()){
-                        std::cout << "Skipping  " << keywords1[i] << std::endl;
-                    } else {
-
-                        std::cout << "Comparing " << keywords1[i] << " ... ";
-
-                        if (arrayType1[i] == INTE) {
-                            auto vect1 = rst1->getRestartData<int>(keywords1[i], seqn, 0);
-                            auto vect2 = rst2->getRestartData<int>(keywords2[ind2], seqn, 0);
-                            compareVectors(vect1, vect2, keywords1[i], reference);
-                        } else if (arrayType1[i] == REAL) {
-                            auto vect1 = rst1->getRestartData<float>(keywords1[i], seqn, 0);
-                            auto vect2 = rst2->getRestartData<float>(keywords2[ind2], seqn, 0);
-                            compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
-                        } else if (arrayType1[i] == DOUB) {
-                            auto vect1 = rst1->getRestartData<double>(keywords1[i], seqn, 0);
-                            auto vect2 = rst2->getRestartData<double>(keywords2[ind2], seqn, 0);
-
-                            // hack in order to not test doubhead[1], dependent on simulation results
-                            // All ohter items in DOUBHEAD are tested with strict tolerances
-                            if (keywords1[i]=="DOUBHEAD"){
-                                vect2[1] = vect1[1];
-                            }
-                            compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
-                        } else if (arrayType1[i] == LOGI) {
-                            auto vect1 = rst1->getRestartData<bool>(keywords1[i], seqn, 0);
-                            auto vect2 = rst2->getRestartData<bool>(keywords2[ind2], seqn, 0);
-                            compareVectors(vect1, vect2, keywords1[i], reference);
-                        } else if (arrayType1[i] == CHAR) {
-                            auto vect1 = rst1->getRestartData<std::string>(keywords1[i], seqn, 0);
-                            auto vect2 = rst2->getRestartData<std::string>(keywords2[ind2], seqn, 0);
-                            compareVectors(vect1, vect2, keywords1[i], reference);
-                        } else if (arrayType1[i] == MESS) {
-                            // shold not be any associated data
-                        } else {
-                            std::cout << "unknown array type " << std::endl;
-                            exit(1);
-                        }
-
-                        std::cout << " done." << std::endl;
-                    }
+                    this->num_errors += stepTest.num_errors;
+                    failure = stepFailure;
                 }
             }
         }
 
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+
         if (!deviations.empty()) {
             printDeviationReport();
         }
     } else {
-        std::cout << "\n!Warning, restart files not found, hence not compared. \n" << std::endl;
+        *reportStream << "\n!Warning, restart files not found, hence not compared. \n" << std::endl;
     }
 
 }
@@ -958,27 +1052,27 @@ void ECLRegressionTest::results_smry()
 
     if ((foundSmspec1) && (not foundSmspec2)){
         std::string message ="test case summary file " + rootName2 + ".SMSPEC not found";
-	std::cout << message << std::endl;
+	*reportStream << message << std::endl;
         OPM_THROW(std::runtime_error, message);
     }
 
     if (foundSmspec1 && foundSmspec2) {
         ESmry smry1(fileName1, loadBaseRunData);
         smry1.loadData();
-        std::cout << "\nLoading summary file " << fileName1 << "  .... done" << std::endl;
+        *reportStream << "\nLoading summary file " << fileName1 << "  .... done" << std::endl;
 
         ESmry smry2(fileName2, loadBaseRunData);
         smry2.loadData();
-        std::cout << "Loading summary file " << fileName2 << "  .... done" << std::endl;
+        *reportStream << "Loading summary file " << fileName2 << "  .... done" << std::endl;
 
         deviations.clear();
 
         std::string reference = "Summary file";
 
-        std::cout << "\nComparing summary files " << std::endl;
+        *reportStream << "\nComparing summary files " << std::endl;
 
         if (reportStepOnly){
-            std::cout << " -- Values at report steps will be compared. Time steps in between reports are ignored " << std::endl;
+            *reportStream << " -- Values at report steps will be compared. Time steps in between reports are ignored " << std::endl;
         }
 
         std::vector<std::string> keywords1 = smry1.keywordList();
@@ -1052,12 +1146,12 @@ void ECLRegressionTest::results_smry()
                 keywords1.erase(std::remove_if(keywords1.begin(), keywords1.end(), make_remover(keywordsBlackListExtraRestart)), keywords1.end());
             }
 
-            std::cout << "\nChecking " << keywords1.size() << "  vectors  ... ";
+            *reportStream << "\nChecking " << keywords1.size() << "  vectors  ... ";
 
             for (size_t i = 0; i < keywords1.size(); i++) {
                 auto it1 = std::find(keywords2.begin(), keywords2.end(), keywords1[i]);
                 if (it1 == keywords2.end() and acceptExtraKeywordsBoth) {
-                    std::cout << "\nSkipping comparison for kw " << keywords1[i];
+                    *reportStream << "\nSkipping comparison for kw " << keywords1[i];
                     continue;
                 }
 
@@ -1082,10 +1176,10 @@ void ECLRegressionTest::results_smry()
                 compareFloatingPointVectors(vect1, vect2, keywords1[i], reference);
             }
 
-            std::cout << " done." << std::endl;
+            *reportStream << " done." << std::endl;
 
             if (blackListed.size()>0){
-                std::cout << "Number of black listed vectors " << blackListed.size() << " (not compared) " << std::endl;
+                *reportStream << "Number of black listed vectors " << blackListed.size() << " (not compared) " << std::endl;
             }
 
             if (!deviations.empty()) {
@@ -1094,7 +1188,7 @@ void ECLRegressionTest::results_smry()
         }
 
     } else {
-        std::cout << "\n!Warning, summary files not found, hence not compared. \n" << std::endl;
+        *reportStream << "\n!Warning, summary files not found, hence not compared. \n" << std::endl;
     }
 
 }
@@ -1109,25 +1203,25 @@ void ECLRegressionTest::results_rsm()
 
         ESmry smry2(fileName1, loadBaseRunData);
         smry2.loadData();
-        std::cout << "\nLoading summary file " << fileName1 << "  .... done" << std::endl;
+        *reportStream << "\nLoading summary file " << fileName1 << "  .... done" << std::endl;
 
         namespace fs = std::filesystem;
         std::string rsm_file = rootName2 + ".RSM";
         if (fs::is_regular_file(fs::path(rsm_file))) {
-            std::cout << "\nLoading RSM file " << rsm_file << "  .... " << std::flush;
+            *reportStream << "\nLoading RSM file " << rsm_file << "  .... " << std::flush;
             auto rsm = ERsm(rsm_file);
-            std::cout << " done " << std::endl << std::flush;;
+            *reportStream << " done " << std::endl << std::flush;;
 
-            std::cout << "\nComparing RSM file against SMRY file  .... " << std::flush;
+            *reportStream << "\nComparing RSM file against SMRY file  .... " << std::flush;
 
             if (!cmp(smry2, rsm))
                 HANDLE_ERROR(std::runtime_error, "The RSM file did not compare equal to the summary file");
 
-            std::cout << " done " << std::endl << std::flush;;
+            *reportStream << " done " << std::endl << std::flush;;
         }
 
     } else {
-        std::cout << "\n!Warning, summary and/or RSM - file not found, hence not compared. \n" << std::endl;
+        *reportStream << "\n!Warning, summary and/or RSM - file not found, hence not compared. \n" << std::endl;
     }
 }
 
@@ -1140,16 +1234,16 @@ void ECLRegressionTest::results_rft()
 
     if ((!foundRft1 && foundRft2) || (foundRft1 && !foundRft2)) {
         std::string message ="test case rft file " + (foundRft1 ? rootName1 : rootName2) + ".RFT not found";
-        std::cout << message << std::endl;
+        *reportStream << message << std::endl;
         OPM_THROW(std::runtime_error, message);
     }
 
     if (foundRft1 && foundRft2) {
         ERft rft1(fileName1);
-        std::cout << "\nLoading rft file " << fileName1 << "  .... done" << std::endl;
+        *reportStream << "\nLoading rft file " << fileName1 << "  .... done" << std::endl;
 
         ERft rft2(fileName2);
-        std::cout << "Loading rft file " << fileName2 << "  .... done\n" << std::endl;
+        *reportStream << "Loading rft file " << fileName2 << "  .... done\n" << std::endl;
 
         auto rftReportList1 = rft1.listOfRftReports();
         auto rftReportList2 = rft2.listOfRftReports();
@@ -1184,7 +1278,7 @@ void ECLRegressionTest::results_rft()
 
             std::string dateStr = std::to_string(std::get<0>(date)) + "/" + std::to_string(std::get<1>(date)) + "/" + std::to_string(std::get<2>(date));
 
-            std::cout << "Well: " << well << " date: " << dateStr << std::endl;
+            *reportStream << "Well: " << well << " date: " << dateStr << std::endl;
 
             std::string reference = "RFT: " + well + ", " + dateStr;
 
@@ -1221,9 +1315,9 @@ void ECLRegressionTest::results_rft()
                     auto it = std::find(keywordsBlackList.begin(), keywordsBlackList.end(), keyword);
 
                     if (it != keywordsBlackList.end()){
-                        std::cout << "Skipping  " << keyword << std::endl;
+                        *reportStream << "Skipping  " << keyword << std::endl;
                     } else {
-                        std::cout << "Comparing: " << keyword << " ... ";
+                        *reportStream << "Comparing: " << keyword << " ... ";
 
                         if (arrayType == INTE) {
                             auto vect1 = rft1.getRft<int>(keyword, well, date);
@@ -1248,22 +1342,22 @@ void ECLRegressionTest::results_rft()
                         } else if (arrayType == MESS) {
                             // shold not be any associated data
                         } else {
-                            std::cout << "unknown array type " << std::endl;
+                            *reportStream << "unknown array type " << std::endl;
                             exit(1);
                         }
 
-                        std::cout << " done." << std::endl;
+                        *reportStream << " done." << std::endl;
                     }
                 }
             }
-            std::cout << std::endl;
+            *reportStream << std::endl;
         }
 
         if (!deviations.empty()) {
             printDeviationReport();
         }
     } else {
-        std::cout << "\n!Warning, rft files not found, hence not compared. \n" << std::endl;
+        *reportStream << "\n!Warning, rft files not found, hence not compared. \n" << std::endl;
     }
 }
 
@@ -1295,7 +1389,7 @@ void ECLRegressionTest::printComparisonForKeywordLists(const std::vector<std::st
 
     maxLen += 4;
 
-    std::cout << std::endl;
+    *reportStream << std::endl;
 
     for (auto& it : commonList) {
         auto it1 = std::find(arrayList1.begin(), arrayList1.end(), it);
@@ -1305,29 +1399,29 @@ void ECLRegressionTest::printComparisonForKeywordLists(const std::vector<std::st
         int ind2 = std::distance(arrayList2.begin(),it2);
 
         if (arrayType1[ind1] != arrayType2[ind2]) {
-            std::cout << "\033[1;31m";
+            *reportStream << "\033[1;31m";
         }
 
         if (std::find(arrayList1.begin(), arrayList1.end(), it) != arrayList1.end()) {
-            std::cout <<  std::setw(maxLen) << it << " (" <<  arrTypeStrList[arrayType1[ind1]] << ") | ";
+            *reportStream <<  std::setw(maxLen) << it << " (" <<  arrTypeStrList[arrayType1[ind1]] << ") | ";
         } else {
-            std::cout <<  std::setw(maxLen) << "" << "        | ";
+            *reportStream <<  std::setw(maxLen) << "" << "        | ";
         }
 
         if (std::find(arrayList2.begin(), arrayList2.end(), it) != arrayList2.end()) {
-            std::cout <<  std::setw(maxLen) << it << " (" <<  arrTypeStrList[arrayType2[ind2]] << ") ";
+            *reportStream <<  std::setw(maxLen) << it << " (" <<  arrTypeStrList[arrayType2[ind2]] << ") ";
         } else {
-            std::cout <<  std::setw(maxLen) << "";
+            *reportStream <<  std::setw(maxLen) << "";
         }
 
         if (arrayType1[ind1] != arrayType2[ind2]) {
-            std::cout << " !" << "\033[0m";
+            *reportStream << " !" << "\033[0m";
         }
 
-        std::cout << std::endl;
+        *reportStream << std::endl;
     }
 
-    std::cout << std::endl << std::endl;
+    *reportStream << std::endl << std::endl;
 }
 
 
@@ -1344,19 +1438,19 @@ void ECLRegressionTest::printMissingKeywords(const std::vector<std::string>& arr
         commonList.insert(key);
     }
 
-    std::cout << "\nKeywords found in second case, but missing in first case: \n" << std::endl;
+    *reportStream << "\nKeywords found in second case, but missing in first case: \n" << std::endl;
 
     for (auto& it : commonList) {
         if (std::find(arrayList1.begin(), arrayList1.end(), it) == arrayList1.end()) {
-            std::cout << "  > '" << it  << "'" << std::endl;
+            *reportStream << "  > '" << it  << "'" << std::endl;
         }
     }
 
-    std::cout << "\nKeywords found in first case, but missing in second case: \n" << std::endl;
+    *reportStream << "\nKeywords found in first case, but missing in second case: \n" << std::endl;
 
     for (auto& it : commonList) {
         if (std::find(arrayList2.begin(), arrayList2.end(), it) == arrayList2.end()) {
-            std::cout << "  > '" << it  << "'" << std::endl;
+            *reportStream << "  > '" << it  << "'" << std::endl;
         }
     }
 }
@@ -1384,23 +1478,23 @@ void ECLRegressionTest::printComparisonForKeywordLists(const std::vector<std::st
 
     maxLen += 2;
 
-    std::cout << std::endl;
+    *reportStream << std::endl;
 
     for (auto& it : commonList) {
         if (std::find(arrayList1.begin(), arrayList1.end(), it) != arrayList1.end()) {
-            std::cout <<  std::setw(maxLen) << it  << " | ";
+            *reportStream <<  std::setw(maxLen) << it  << " | ";
         } else {
-            std::cout <<  std::setw(maxLen) << "" << " | ";
+            *reportStream <<  std::setw(maxLen) << "" << " | ";
         }
 
         if (std::find(arrayList2.begin(), arrayList2.end(), it) != arrayList2.end()) {
-            std::cout <<  std::setw(maxLen) << it << "";
+            *reportStream <<  std::setw(maxLen) << it << "";
         } else {
-            std::cout <<  std::setw(maxLen) << "" ;
+            *reportStream <<  std::setw(maxLen) << "" ;
         }
 
-        std::cout << std::endl;
+        *reportStream << std::endl;
     }
 
-    std::cout << std::endl;
+    *reportStream << std::endl;
 }
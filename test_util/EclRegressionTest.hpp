@@ -24,8 +24,11 @@
 
 #include <opm/io/eclipse/EclIOdata.hpp>
 
+#include <memory>
+
 namespace Opm { namespace EclIO {
     class EGrid;
+    class ERst;
 }}
 
 namespace EIOD = Opm::EclIO;
@@ -50,8 +53,6 @@ public:
                       double absToleranceArg, double relToleranceArg):
         ECLFilesComparator(basename1, basename2, absToleranceArg, relToleranceArg) {}
 
-    ~ECLRegressionTest();
-
     //! \brief Option to only compare last occurrence
     void setOnlyLastReportNumber(bool onlyLastSequenceArg) {
         this->onlyLastSequence = onlyLastSequenceArg;
@@ -109,8 +110,6 @@ public:
 private:
     bool checkFileName(const std::string& rootName, const std::string& extension, std::string& filename);
 
-    // Prints results stored in absDeviation and relDeviation.
-    void printResultsForKeyword(const std::string& keyword) const;
     void printComparisonForKeywordLists(const std::vector<std::string>& arrayList1,
                                         const std::vector<std::string>& arrayList2) const;
 
@@ -126,6 +125,10 @@ private:
                          const std::vector<std::string>& keywords2,
                          const std::string& reference);
 
+    // Compares report step 'seqn' of the two restart files and releases
+    // its data when done.
+    void compareRestartStep(Opm::EclIO::ERst& rst1, Opm::EclIO::ERst& rst2, int seqn);
+
     void checkSpecificKeyword(std::vector<std::string>& keywords1,
                               std::vector<std::string>& keywords2,
                               std::vector<EIOD::eclArrType>& arrayType1,
@@ -143,7 +146,7 @@ private:
     // deviationsForCell throws an exception if both the absolute deviation AND the relative deviation
     // are larger than absTolerance and relTolerance, respectively. In addition,
     // if allowNegativeValues is passed as false, an exception will be thrown when the absolute value
-    // of a negative value exceeds absTolerance. If no exceptions are thrown, the absolute and relative deviations are added to absDeviation and relDeviation.
+    // of a negative value exceeds absTolerance.
     // void deviationsForCell(double val1, double val2, const std::string& keyword, const std::string reference, size_t kw_size, size_t cell, bool allowNegativeValues = true);
 
     void deviationsForCell(double val1, double val2, const std::string& keyword,
@@ -155,9 +158,6 @@ private:
                                         const std::string& reference,
                                         size_t kw_size, size_t cell);
 
-    // These vectors store absolute and relative deviations, respecively. Note that they are whiped clean for every new keyword comparison.
-    std::vector<double> absDeviation, relDeviation;
-
     // Keywords which should not contain negative values, i.e. uses allowNegativeValues = false in deviationsForCell():
     const std::vector<std::string> keywordDisallowNegatives = {};//{"SGAS", "SWAT", "PRESSURE"};
 
@@ -193,8 +193,9 @@ private:
     bool acceptExtraKeywords = false;
     bool acceptExtraKeywordsBoth = false;
 
-    Opm::EclIO::EGrid* grid1 = nullptr;
-    Opm::EclIO::EGrid* grid2 = nullptr;
+    // Shared with the copies comparing restart steps in parallel.
+    std::shared_ptr<Opm::EclIO::EGrid> grid1;
+    std::shared_ptr<Opm::EclIO::EGrid> grid2;
 };
 
 #endif
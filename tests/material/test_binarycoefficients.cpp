@@ -39,10 +39,15 @@
 #include <opm/material/densead/Math.hpp>
 
 #include <opm/material/binarycoefficients/Brine_CO2.hpp>
+#include <opm/material/binarycoefficients/Brine_CO2SolubilityTable.hpp>
 #include <opm/material/components/SimpleHuDuanH2O.hpp>
 #include <opm/material/components/CO2.hpp>
 #include <opm/material/components/CO2Tables.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/Co2GasPvt.hpp>
+
+#include <array>
+#include <map>
 
 template<class Scalar>
 bool close_at_tolerance(Scalar n1, Scalar n2, Scalar tolerance)
@@ -176,6 +181,192 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Brine_CO2, Scalar, Types)
     
 }
 
+BOOST_AUTO_TEST_CASE(Brine_CO2SolubilityTable)
+{
+    using Scalar = double;
+    using Evaluation = Opm::DenseAd::Evaluation<Scalar, 2>;
+
+    using H2O = Opm::SimpleHuDuanH2O<Scalar>;
+    using CO2 = Opm::CO2<Scalar>;
+
+    using BinaryCoeffBrineCO2 = Opm::BinaryCoeff::Brine_CO2<Scalar, H2O, CO2>;
+    using SolubilityTable = Opm::BinaryCoeff::Brine_CO2SolubilityTable<Scalar>;
+
+    Opm::CO2Tables params;
+    const Scalar tolerance = 1e-4;
+
+    // Activity model 2 uses fixed-point iterations above 100 C
+    for (const int activityModel : {1, 2, 3}) {
+        std::map<std::array<Scalar, 3>, int> numEvaluations;
+        const auto solubility = [&params, &numEvaluations, activityModel](Scalar T, Scalar p, Scalar S)
+        {
+            ++numEvaluations[{T, p, S}];
+            Scalar xlCO2, xgH2O;
+            BinaryCoeffBrineCO2::calculateMoleFractions(params, T, p, S, -1, xlCO2, xgH2O,
+                                                        activityModel, true);
+            return std::pair{xlCO2, xgH2O};
+        };
+
+        const SolubilityTable table(solubility, 303.15, 393.15, 1e5, 600e5, {0.0, 0.1}, tolerance);
+        // Activity model 1 jumps at zero salinity, model 2 at 100 C. There the
+        // refinement stops at the minimum interval width.
+        if (activityModel == 3) {
+            BOOST_CHECK_LE(table.maxInterpolationError(), tolerance);
+        }
+        BOOST_CHECK(!table.applies(Scalar(293.15), Scalar(100e5), Scalar(0.05)));
+        BOOST_CHECK(!table.applies(Scalar(313.15), Scalar(100e5), Scalar(0.2)));
+
+        // Refinement only samples the inserted nodes
+        for (const auto T : table.temperatures()) {
+            for (const auto p : table.pressures()) {
+                for (const auto S : table.salinities()) {
+                    BOOST_CHECK_EQUAL((numEvaluations[{T, p, S}]), 1);
+                }
+            }
+        }
+
+        // The interpolation error along each axis is bounded by the tolerance
+        // at the midpoints of the intervals, and the errors of the axes add up
+        // for points inside a cell of the grid.
+        for (const Scalar T : {305.0, 333.15, 371.3, 390.0}) {
+            for (const Scalar p : {2e5, 47e5, 73.8e5, 150e5, 444e5}) {
+                for (const Scalar S : {0.0, 0.037, 0.1}) {
+                    const Evaluation temperature = Evaluation::createVariable(T, 0);
+                    const Evaluation pressure = Evaluation::createVariable(p, 1);
+                    const Evaluation salinity = S;
+                    BOOST_REQUIRE(table.applies(temperature, pressure, salinity));
+
+                    Evaluation xlCO2, xgH2O;
+                    table.calculateMoleFractions(temperature, pressure, salinity, xlCO2, xgH2O);
+
+                    Evaluation xlCO2_ref, xgH2O_ref;
+                    BinaryCoeffBrineCO2::calculateMoleFractions(params, temperature, pressure, salinity, -1,
+                                                                xlCO2_ref, xgH2O_ref, activityModel, true);
+
+                    BOOST_CHECK_SMALL(xlCO2.value() - xlCO2_ref.value(), 3 * tolerance);
+                    BOOST_CHECK_SMALL(xgH2O.value() - xgH2O_ref.value(), 3 * tolerance);
+                    // Close to the critical point the solubility may decrease with pressure
+                    BOOST_CHECK(xlCO2.derivative(1) * xlCO2_ref.derivative(1) > 0.0);
+                }
+            }
+        }
+    }
+
+    // Isothermal table
+    const auto solubility = [&params](Scalar T, Scalar p, Scalar S)
+    {
+        Scalar xlCO2, xgH2O;
+        BinaryCoeffBrineCO2::calculateMoleFractions(params, T, p, S, -1, xlCO2, xgH2O, 3, true);
+        return std::pair{xlCO2, xgH2O};
+    };
+    const SolubilityTable table(solubility, 333.15, 333.15, 1e5, 600e5, {0.05}, tolerance);
+    BOOST_CHECK_EQUAL(table.temperatures().size(), 1);
+    BOOST_CHECK(!table.applies(Scalar(334.15), Scalar(100e5), Scalar(0.05)));
+    for (const Scalar p : {2e5, 47e5, 73.8e5, 150e5, 444e5}) {
+        const Evaluation pressure = Evaluation::createVariable(p, 1);
+        BOOST_REQUIRE(table.applies(Evaluation(333.15), pressure, Evaluation(0.05)));
+
+        Evaluation xlCO2, xgH2O;
+        table.calculateMoleFractions(Evaluation(333.15), pressure, Evaluation(0.05), xlCO2, xgH2O);
+        const auto [xlCO2_ref, xgH2O_ref] = solubility(333.15, p, 0.05);
+        BOOST_CHECK_SMALL(xlCO2.value() - xlCO2_ref, tolerance);
+        BOOST_CHECK_SMALL(xgH2O.value() - xgH2O_ref, tolerance);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Brine_CO2SolubilityTableRefinementLimit)
+{
+    using Scalar = double;
+    using SolubilityTable = Opm::BinaryCoeff::Brine_CO2SolubilityTable<Scalar>;
+
+    // A jump cannot be resolved, so the interval around it is split until it
+    // reaches the range divided by the square of the maximum number of intervals
+    const auto solubility = [](Scalar, Scalar p, Scalar)
+    {
+        return std::pair{p < 50e5 ? Scalar{0.01} : Scalar{0.02}, Scalar{0.0}};
+    };
+
+    const Scalar pmin = 1e5;
+    const Scalar pmax = 601e5;
+    const std::size_t maxPointsPerAxis = 65;
+    const SolubilityTable table(solubility, 333.15, 333.15, pmin, pmax, {0.0}, 1e-6, maxPointsPerAxis);
+
+    const auto& pressures = table.pressures();
+    BOOST_CHECK_LE(pressures.size(), maxPointsPerAxis);
+    BOOST_CHECK_GT(table.maxInterpolationError(), 1e-6);
+
+    const Scalar minWidth = (pmax - pmin) / ((maxPointsPerAxis - 1) * (maxPointsPerAxis - 1));
+    Scalar smallest = pmax - pmin;
+    for (std::size_t i = 0; i + 1 < pressures.size(); ++i) {
+        smallest = std::min(smallest, pressures[i + 1] - pressures[i]);
+    }
+    BOOST_CHECK_CLOSE(smallest, minWidth, 1e-8);
+}
+
+BOOST_AUTO_TEST_CASE(Co2PvtSharedSolubilityTable)
+{
+    const std::vector<double> salinity = {0.05};
+    Opm::BrineCo2Pvt<double> brine(salinity);
+    Opm::Co2GasPvt<double> gas(salinity);
+
+    // The brine and gas PVT objects of a CO2SOLTB record use one table
+    brine.initSolubilityTable(333.15, 333.15, 1e5, 300e5, 1e-4);
+    gas.initSolubilityTable(333.15, 333.15, 1e5, 300e5, 1e-4);
+    BOOST_REQUIRE(brine.solubilityTable());
+    BOOST_CHECK(brine.solubilityTable() == gas.solubilityTable());
+
+    // A salinity following the salt concentration needs another table
+    gas.initSolubilityTable(333.15, 333.15, 1e5, 300e5, 1e-4, /*variableSalinity=*/true);
+    BOOST_CHECK(brine.solubilityTable() != gas.solubilityTable());
+    BOOST_CHECK_EQUAL(gas.solubilityTable()->salinities().front(), 0.0);
+    BOOST_CHECK_GE(gas.solubilityTable()->salinities().back(), 0.27);
+}
+
+BOOST_AUTO_TEST_CASE(Co2PvtSharedTables)
+{
+    const std::vector<double> salinity = {0.05};
+    const Opm::BrineCo2Pvt<double> brine1(salinity);
+    const Opm::BrineCo2Pvt<double> brine2(salinity);
+    const Opm::Co2GasPvt<double> gas(salinity);
+    const auto copy = brine1;
+
+    const auto& density = brine1.getParams().tabulatedDensity.samples();
+    BOOST_CHECK(density.sharesWith(brine2.getParams().tabulatedDensity.samples()));
+    BOOST_CHECK(density.sharesWith(gas.getParams().tabulatedDensity.samples()));
+    BOOST_CHECK(density.sharesWith(copy.getParams().tabulatedDensity.samples()));
+    BOOST_CHECK(brine1.getParams().tabulatedEnthalpy.samples()
+                .sharesWith(gas.getParams().tabulatedEnthalpy.samples()));
+
+    // Same results as with tables owned by the PVT object
+    const Opm::BrineCo2Pvt<double, Opm::CO2Tables<double, std::vector<double>>> owned(salinity);
+    for (const double p : {5e5, 100e5, 300e5}) {
+        BOOST_CHECK_EQUAL(brine1.rsSat(0, 333.15, p, 0.05), owned.rsSat(0, 333.15, p, 0.05));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(BrineCo2PvtSolubilityTable)
+{
+    using Scalar = double;
+    using Evaluation = Opm::DenseAd::Evaluation<Scalar, 1>;
+
+    const std::vector<Scalar> salinity = {0.05};
+    Opm::BrineCo2Pvt<Scalar> analytic(salinity, /*activityModel=*/3);
+    Opm::BrineCo2Pvt<Scalar> tabulated(salinity, /*activityModel=*/3);
+    tabulated.initSolubilityTable(333.15, 333.15, 1e5, 300e5, 1e-5);
+    BOOST_REQUIRE(tabulated.solubilityTable());
+
+    // A mole fraction error of 1e-5 corresponds to less than 0.1% of the
+    // dissolved CO2 at these conditions
+    for (const Scalar p : {5e5, 47e5, 73.8e5, 150e5, 280e5}) {
+        const Evaluation T = 333.15;
+        const Evaluation pressure = Evaluation::createVariable(p, 0);
+        const auto rs = analytic.rsSat(/*regionIdx=*/0, T, pressure, Evaluation(salinity[0]));
+        const auto rsTab = tabulated.rsSat(/*regionIdx=*/0, T, pressure, Evaluation(salinity[0]));
+        BOOST_CHECK_GT(rs.value(), 0.0);
+        BOOST_CHECK_CLOSE(rsTab.value(), rs.value(), 0.1);
+    }
+}
+
 BOOST_AUTO_TEST_CASE_TEMPLATE(BrineDensityWithCO2, Scalar, Types)
 {
     using Evaluation = Opm::DenseAd::Evaluation<Scalar, 3>;
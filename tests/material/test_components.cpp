@@ -775,3 +775,37 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(H2Class, Scalar, Types)
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE(SharedCO2Tables)
+{
+    const Opm::CO2Tables reference;
+    const Opm::SharedCO2Tables shared1;
+    const Opm::SharedCO2Tables shared2;
+    const Opm::CompactCO2Tables compact;
+
+    // all default constructed shared tables refer to the same samples
+    BOOST_CHECK(shared1.tabulatedDensity.samples().sharesWith(shared2.tabulatedDensity.samples()));
+    BOOST_CHECK(shared1.tabulatedEnthalpy.samples().sharesWith(shared2.tabulatedEnthalpy.samples()));
+    BOOST_CHECK(Opm::CompactCO2Tables{}.tabulatedDensity.samples().sharesWith(compact.tabulatedDensity.samples()));
+
+    const auto copy = shared1;
+    BOOST_CHECK(copy.tabulatedDensity.samples().sharesWith(shared1.tabulatedDensity.samples()));
+
+    BOOST_CHECK_EQUAL(shared1.tabulatedDensity.samples().size(),
+                      reference.tabulatedDensity.samples().size());
+    BOOST_CHECK_EQUAL(compact.tabulatedEnthalpy.samples().size(),
+                      reference.tabulatedEnthalpy.samples().size());
+
+    for (const double T : {280.0, 320.0, 360.0}) {
+        for (const double p : {1e5, 5e6, 1e7, 3e7}) {
+            const double rho = reference.tabulatedDensity.eval(T, p, true);
+            const double h = reference.tabulatedEnthalpy.eval(T, p, true);
+
+            BOOST_CHECK_EQUAL(shared1.tabulatedDensity.eval(T, p, true), rho);
+            BOOST_CHECK_EQUAL(shared1.tabulatedEnthalpy.eval(T, p, true), h);
+
+            BOOST_CHECK(close_at_tolerance(compact.tabulatedDensity.eval(T, p, true), rho, 1e-6));
+            BOOST_CHECK(close_at_tolerance(compact.tabulatedEnthalpy.eval(T, p, true), h, 1e-6));
+        }
+    }
+}
@@ -189,3 +189,78 @@ for (const auto& sample : test_methods) {
 }
 #endif
 }
+
+BOOST_AUTO_TEST_CASE(PtFlashBatch)
+{
+    using Flash = Opm::PTFlash<double, FluidSystem>;
+
+    const double flash_tolerance = 1.e-8;
+    const Scalar temp = 300.0;
+    const std::vector<double> pressures {5e5, 10e5, 20e5, 50e5, 100e5, 150e5, 200e5};
+
+    const auto makeFluidState = [temp](const double p)
+    {
+        FluidState fluid_state;
+        fluid_state.setPressure(FluidSystem::oilPhaseIdx, Evaluation::createVariable(p, 0));
+        fluid_state.setPressure(FluidSystem::gasPhaseIdx, Evaluation::createVariable(p, 0));
+        fluid_state.setMoleFraction(FluidSystem::Comp0Idx, Evaluation::createVariable(0.5, 1));
+        fluid_state.setMoleFraction(FluidSystem::Comp1Idx, Evaluation::createVariable(0.3, 2));
+        fluid_state.setMoleFraction(FluidSystem::Comp2Idx, 1. - fluid_state.moleFraction(0) - fluid_state.moleFraction(1));
+        fluid_state.setTemperature(temp);
+        for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+            fluid_state.setKvalue(compIdx, fluid_state.wilsonK_(compIdx));
+        }
+        fluid_state.setLvalue(1.);
+        return fluid_state;
+    };
+
+    // Compares a batch solution to cold started solve() calls
+    const auto checkBatch = [&makeFluidState, flash_tolerance](const std::vector<double>& cell_pressures,
+                                                               const std::vector<FluidState>& batch_states,
+                                                               const std::vector<bool>& is_single_phase,
+                                                               const EOSType& eos_type)
+    {
+        BOOST_REQUIRE_EQUAL(is_single_phase.size(), cell_pressures.size());
+        for (std::size_t cell = 0; cell < cell_pressures.size(); ++cell) {
+            auto fluid_state = makeFluidState(cell_pressures[cell]);
+            const bool single_phase = Flash::solve(fluid_state, "ssi+newton", flash_tolerance, eos_type);
+            BOOST_CHECK_EQUAL(single_phase, is_single_phase[cell]);
+
+            BOOST_CHECK(Opm::MathToolbox<Evaluation>::isSame(fluid_state.L(), batch_states[cell].L(), 1e-6));
+            for (unsigned comp_idx = 0; comp_idx < numComponents; ++comp_idx) {
+                BOOST_CHECK(Opm::MathToolbox<Evaluation>::isSame(fluid_state.moleFraction(FluidSystem::oilPhaseIdx, comp_idx),
+                                                                 batch_states[cell].moleFraction(FluidSystem::oilPhaseIdx, comp_idx), 1e-6));
+                BOOST_CHECK(Opm::MathToolbox<Evaluation>::isSame(fluid_state.moleFraction(FluidSystem::gasPhaseIdx, comp_idx),
+                                                                 batch_states[cell].moleFraction(FluidSystem::gasPhaseIdx, comp_idx), 1e-6));
+            }
+        }
+    };
+
+    for (const auto& eos_type : test_eos_types) {
+        std::vector<FluidState> batch_states;
+        for (const auto p : pressures) {
+            batch_states.push_back(makeFluidState(p));
+        }
+
+        const auto is_single_phase = Flash::solveBatch(batch_states, "ssi+newton", flash_tolerance, eos_type);
+        checkBatch(pressures, batch_states, is_single_phase, eos_type);
+        BOOST_CHECK(is_single_phase.front() != is_single_phase.back());
+
+        // A second call is warm started from the solution of the first one
+        const auto is_single_phase_warm = Flash::solveBatch(batch_states, "ssi+newton", flash_tolerance, eos_type, 1e-3);
+        BOOST_CHECK(is_single_phase_warm == is_single_phase);
+        checkBatch(pressures, batch_states, is_single_phase_warm, eos_type);
+
+        // Lowering the pressure brings the single-phase cells into the two-phase
+        // region.  Their K-values from the previous solution would wrongly place
+        // them far from the phase boundary, so they must not be used.
+        std::vector<double> new_pressures;
+        for (std::size_t cell = 0; cell < pressures.size(); ++cell) {
+            new_pressures.push_back(0.5 * pressures[cell]);
+            batch_states[cell].setPressure(FluidSystem::oilPhaseIdx, Evaluation::createVariable(new_pressures[cell], 0));
+            batch_states[cell].setPressure(FluidSystem::gasPhaseIdx, Evaluation::createVariable(new_pressures[cell], 0));
+        }
+        const auto is_single_phase_new = Flash::solveBatch(batch_states, "ssi+newton", flash_tolerance, eos_type, 1e-3);
+        checkBatch(new_pressures, batch_states, is_single_phase_new, eos_type);
+    }
+}
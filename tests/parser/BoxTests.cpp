@@ -205,3 +205,36 @@ BOOST_AUTO_TEST_CASE(TestKeywordBox2) {
         BOOST_CHECK_EQUAL(il[i].active_index, 98 + i*100);
     }
 }
+
+BOOST_AUTO_TEST_CASE(SubBoxIndexList) {
+    const Opm::GridDims gridDims(4, 3, 5);
+    auto isActive = Opm::Box::IsActive {
+        [](const std::size_t global_index) { return global_index % 2 == 0; }
+    };
+    auto activeIdx = Opm::Box::ActiveIdx {
+        [](const std::size_t global_index) { return global_index / 2; }
+    };
+
+    const Opm::Box box(gridDims, isActive, activeIdx, 1,2, 0,1, 2,4);
+    const auto& global_list = box.global_index_list();
+    BOOST_REQUIRE_EQUAL(global_list.size(), box.size());
+
+    std::size_t data_index = 0;
+    for (std::size_t k = 2; k <= 4; ++k) {
+        for (std::size_t j = 0; j <= 1; ++j) {
+            for (std::size_t i = 1; i <= 2; ++i, ++data_index) {
+                const auto& cell = global_list[data_index];
+                BOOST_CHECK_EQUAL(cell.data_index, data_index);
+                BOOST_CHECK_EQUAL(cell.global_index, gridDims.getGlobalIndex(i, j, k));
+            }
+        }
+    }
+
+    const auto& active_list = box.index_list();
+    BOOST_CHECK_EQUAL(active_list.size(), box.size() / 2);
+    for (const auto& cell : active_list) {
+        BOOST_CHECK_EQUAL(cell.global_index % 2, 0U);
+        BOOST_CHECK_EQUAL(cell.active_index, cell.global_index / 2);
+        BOOST_CHECK_EQUAL(cell.global_index, global_list[cell.data_index].global_index);
+    }
+}
@@ -17,7 +17,9 @@ You should have received a copy of the GNU General Public License
 along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <stdexcept>
+#include <string>
 
 #define BOOST_TEST_MODULE EclipseStateTests
 
@@ -31,6 +33,7 @@ along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 #include <opm/input/eclipse/EclipseState/SimulationConfig/SimulationConfig.hpp>
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/Box.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/Fault.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/FaultCollection.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/TransMult.hpp>
@@ -270,6 +273,68 @@ BOOST_AUTO_TEST_CASE(TitleCorrect) {
     BOOST_CHECK_EQUAL( state.getTitle(), "The title" );
 }
 
+BOOST_AUTO_TEST_CASE(InitTimings) {
+    auto deck = createDeck();
+    EclipseState state( deck );
+
+    const auto& timings = state.initTimings();
+    BOOST_REQUIRE( !timings.empty() );
+    BOOST_CHECK_EQUAL( timings.back().first, "Total" );
+
+    const auto has_phase = [&timings](const std::string& phase) {
+        return std::any_of(timings.begin(), timings.end(),
+                           [&phase](const auto& timing) { return timing.first == phase; });
+    };
+    BOOST_CHECK( has_phase("TableManager") );
+    BOOST_CHECK( has_phase("EclipseGrid") );
+    BOOST_CHECK( has_phase("FieldPropsManager") );
+
+    for (const auto& [phase, time] : timings) {
+        BOOST_CHECK_MESSAGE( time >= 0.0, "Negative time for phase " << phase );
+        BOOST_CHECK( time <= timings.back().second );
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentGridFromSharedDeck) {
+    // The grid thread reads the deck itself, also with GRIDUNIT, and
+    // repeated constructions from the same deck see the same SI data.
+    auto deck = Parser{}.parseString(R"(RUNSPEC
+DIMENS
+ 10 10 10 /
+GRID
+GRIDUNIT
+ FEET /
+DX
+1000*0.25 /
+DYV
+10*0.25 /
+DZ
+1000*0.25 /
+TOPS
+1000*0.25 /
+PORO
+1000*0.10 /
+PERMX
+1000*0.25 /
+PROPS
+REGIONS
+SATNUM
+1000*2 /
+)");
+
+    const EclipseState state1( deck );
+    const EclipseState state2( deck );
+    const EclipseGrid grid( deck );
+
+    const auto& grid1 = state1.getInputGrid();
+    const auto& grid2 = state2.getInputGrid();
+    BOOST_REQUIRE_EQUAL( grid1.getCartesianSize(), grid.getCartesianSize() );
+    for (std::size_t g = 0; g < grid.getCartesianSize(); ++g) {
+        BOOST_CHECK_EQUAL( grid1.getCellVolume(g), grid.getCellVolume(g) );
+        BOOST_CHECK_EQUAL( grid2.getCellVolume(g), grid.getCellVolume(g) );
+    }
+}
+
 BOOST_AUTO_TEST_CASE(IntProperties) {
     auto deck = createDeck();
     EclipseState state( deck );
@@ -532,6 +597,63 @@ THCO2MIX
     BOOST_CHECK( config.gas_type == Co2StoreConfig::GasMixingType::IDEAL);
 }
 
+BOOST_AUTO_TEST_CASE(CO2SOLTB) {
+    const auto deck_string = [](const std::string& co2soltb) {
+        return R"(
+RUNSPEC
+
+DIMENS
+ 2 2 1 /
+
+GRID
+
+DX
+ 4*1 /
+DY
+ 4*1 /
+DZ
+ 4*1 /
+TOPS
+ 4*0.0 /
+
+PORO
+ 4*0.3 /
+
+PROPS
+)" + co2soltb;
+    };
+
+    Parser parser;
+    {
+        EclipseState state(parser.parseString(deck_string("")));
+        BOOST_CHECK(!state.getCo2StoreConfig().solubilityTable().has_value());
+    }
+    {
+        EclipseState state(parser.parseString(deck_string("CO2SOLTB\n 1 300 40 120 1e-4 /\n")));
+        const auto& table = state.getCo2StoreConfig().solubilityTable();
+        BOOST_REQUIRE(table.has_value());
+        BOOST_CHECK_CLOSE(table->pressure_min, 1e5, 1e-8);
+        BOOST_CHECK_CLOSE(table->pressure_max, 300e5, 1e-8);
+        BOOST_REQUIRE(table->temperature_min.has_value());
+        BOOST_REQUIRE(table->temperature_max.has_value());
+        BOOST_CHECK_CLOSE(*table->temperature_min, 313.15, 1e-8);
+        BOOST_CHECK_CLOSE(*table->temperature_max, 393.15, 1e-8);
+        BOOST_CHECK_CLOSE(table->tolerance, 1e-4, 1e-8);
+    }
+    {
+        // Defaulted temperatures refer to the reservoir temperature
+        EclipseState state(parser.parseString(deck_string("CO2SOLTB\n 1 300 /\n")));
+        const auto& table = state.getCo2StoreConfig().solubilityTable();
+        BOOST_REQUIRE(table.has_value());
+        BOOST_CHECK(!table->temperature_min.has_value());
+        BOOST_CHECK(!table->temperature_max.has_value());
+        BOOST_CHECK_CLOSE(table->tolerance, 1e-5, 1e-8);
+    }
+
+    BOOST_CHECK_THROW(EclipseState(parser.parseString(deck_string("CO2SOLTB\n 300 1 /\n"))), std::exception);
+    BOOST_CHECK_THROW(EclipseState(parser.parseString(deck_string("CO2SOLTB\n 1 300 120 40 /\n"))), std::exception);
+}
+
 BOOST_AUTO_TEST_CASE(EzrokhiTablesTest) {
     const auto deck_string = R"(
         RUNSPEC
@@ -2461,6 +2461,47 @@ EQUALREG
     }
 }
 
+BOOST_AUTO_TEST_CASE(GLOBAL_REGION_STATUS) {
+    // The region operation must update the global value status along with
+    // the global values, not only the values themselves.
+    const std::string deck_string { R"(
+GRID
+
+PORO
+   27*0.10 /
+
+ACTNUM
+   9*1 9*0 9*1 /
+
+FLUXNUM
+   27*1 /
+
+EQUALREG
+   MULTZ 2.0 1 F/
+/
+
+)" };
+
+    const auto& fp = make_fp(deck_string);
+    const auto& multz_fp = fp.get_double_field_data("MULTZ");
+
+    BOOST_REQUIRE(multz_fp.global_data.has_value());
+    BOOST_REQUIRE(multz_fp.global_value_status.has_value());
+
+    const auto& multz_data = *multz_fp.global_data;
+    const auto& multz_status = *multz_fp.global_value_status;
+    for (auto i = std::size_t(0); i < multz_data.size(); ++i) {
+        if (i >= 9 && i < 18) {
+            BOOST_CHECK_EQUAL(multz_data[i], 1.0);
+            BOOST_CHECK(multz_status[i] != value::status::deck_value);
+        }
+        else {
+            BOOST_CHECK_EQUAL(multz_data[i], 2.0);
+            BOOST_CHECK(multz_status[i] == value::status::deck_value);
+        }
+    }
+}
+
 
 
 BOOST_AUTO_TEST_CASE(TRAN_Calculator) {
@@ -40,6 +40,7 @@
 #include <opm/input/eclipse/Parser/ParserKeywords/M.hpp>
 
 #include <array>
+#include <cstddef>
 #include <initializer_list>
 #include <stdexcept>
 #include <vector>
@@ -802,6 +803,10 @@ namespace {
         double nnc(const std::array<int,3>& c1,
                    const std::array<int,3>& c2) const;
 
+        // Compare the batch multipliers of all cell pairs and directions
+        // to the multipliers of the individual connections.
+        void checkBatch() const;
+
     private:
         Opm::EclipseGrid grid_;
         Opm::FieldPropsManager fp_;
@@ -832,6 +837,43 @@ namespace {
                                     this->grid_.getGlobalIndex(c2[0], c2[1], c2[2]));
     }
 
+    void TMultRegion::checkBatch() const
+    {
+        const auto directions = std::array {
+            Opm::FaceDir::XPlus, Opm::FaceDir::XMinus,
+            Opm::FaceDir::YPlus, Opm::FaceDir::YMinus,
+            Opm::FaceDir::ZPlus, Opm::FaceDir::ZMinus,
+        };
+
+        auto cell1 = std::vector<std::size_t>{};
+        auto cell2 = std::vector<std::size_t>{};
+        auto faceDirs = std::vector<Opm::FaceDir::DirEnum>{};
+
+        const auto numCells = this->grid_.getCartesianSize();
+        for (auto c1 = 0*numCells; c1 < numCells; ++c1) {
+            for (auto c2 = 0*numCells; c2 < numCells; ++c2) {
+                for (const auto direction : directions) {
+                    cell1.push_back(c1);
+                    cell2.push_back(c2);
+                    faceDirs.push_back(direction);
+                }
+            }
+        }
+
+        const auto regular = this->scanner_.getRegionMultipliers(cell1, cell2, faceDirs);
+        const auto nnc = this->scanner_.getRegionMultipliersNNC(cell1, cell2);
+
+        BOOST_REQUIRE_EQUAL(regular.size(), cell1.size());
+        BOOST_REQUIRE_EQUAL(nnc.size(), cell1.size());
+
+        for (auto i = 0*cell1.size(); i < cell1.size(); ++i) {
+            BOOST_CHECK_EQUAL(regular[i], this->scanner_.getRegionMultiplier(cell1[i], cell2[i], faceDirs[i]));
+            BOOST_CHECK_EQUAL(nnc[i], this->scanner_.getRegionMultiplierNNC(cell1[i], cell2[i]));
+        }
+
+        BOOST_CHECK_THROW(this->scanner_.getRegionMultipliers(cell1, cell2, {}), std::invalid_argument);
+    }
+
     Opm::Deck setup(const std::string& regsets,
                     const std::string& multregt)
     {
@@ -890,6 +932,18 @@ FLUXNUM
 FLUXNUM
 1 5*2   -- K=1
 1 5*2 / -- K=2
+)" };
+        }
+
+        std::string sparse_ids()
+        {
+            return { R"(MULTNUM
+1 5*2   -- K=1
+1 5*2 / -- K=2
+
+FLUXNUM
+7 5*50000   -- K=1
+7 5*50000 / -- K=2
 )" };
         }
     } // namespace Regions
@@ -917,6 +971,16 @@ MULTREGT
 )" };
         }
 
+        std::string sparse_ids()
+        {
+            return { R"(
+MULTREGT
+  7 50000  0.5  1*  'NNC'   'F' /
+  7 7      0.2  1*  'ALL'   'F' /
+/
+)" };
+        }
+
         std::string same_but_different()
         {
             return { R"(
@@ -961,4 +1025,12 @@ BOOST_AUTO_TEST_CASE(Same_Conn_From_Multiple_Regsets)
     BOOST_CHECK_CLOSE(rmult.nnc({ 0, 1, 0 }, { 0, 0, 1 }), 0.05, 1.0e-8);
 }
 
+BOOST_AUTO_TEST_CASE(Batch_Multipliers)
+{
+    TMultRegion { setup(Regions::same(), Multregt::none()) }.checkBatch();
+    TMultRegion { setup(Regions::same(), Multregt::repeated_different_regsets()) }.checkBatch();
+    TMultRegion { setup(Regions::f_plus_one(), Multregt::same_but_different()) }.checkBatch();
+    TMultRegion { setup(Regions::sparse_ids(), Multregt::sparse_ids()) }.checkBatch();
+}
+
 BOOST_AUTO_TEST_SUITE_END()     // MultiRegSet
@@ -130,6 +130,37 @@ BOOST_AUTO_TEST_CASE(getKeyword_hasnotkeyword_getKeywordThrowsException) {
     BOOST_CHECK_THROW(parser.getParserKeywordFromDeckName("FJASS"), std::invalid_argument);
 }
 
+namespace {
+
+int lazyKeywordCount = 0;
+
+ParserKeyword createLazy() {
+    ++lazyKeywordCount;
+    return createDynamicSized("LAZYKW");
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(addBuiltinKeyword_createdOnFirstLookup) {
+    Parser parser( false );
+    parser.addBuiltinKeyword({ "LAZYKW", "LAZYALT" }, &createLazy);
+
+    BOOST_CHECK(parser.isRecognizedKeyword("LAZYKW"));
+    BOOST_CHECK(parser.hasKeyword("LAZYALT"));
+    BOOST_CHECK_EQUAL(lazyKeywordCount, 0);
+
+    const auto& kw = parser.getParserKeywordFromDeckName("LAZYALT");
+    BOOST_CHECK_EQUAL(kw.getName(), "LAZYKW");
+    BOOST_CHECK_EQUAL(&kw, &parser.getKeyword("LAZYKW"));
+    BOOST_CHECK_EQUAL(lazyKeywordCount, 1);
+
+    parser.addBuiltinKeyword<ParserKeywords::TABDIMS>({ "TABDIMS" });
+    BOOST_CHECK_EQUAL(parser.getKeyword("TABDIMS").getName(), "TABDIMS");
+
+    const auto deck_names = std::vector<std::string> { "LAZYALT", "LAZYKW", "TABDIMS" };
+    BOOST_CHECK(parser.getAllDeckNames() == deck_names);
+}
+
 BOOST_AUTO_TEST_CASE(getAllDeckNames_hasTwoKeywords_returnsCompleteList) {
     Parser parser( false );
     std::cout << parser.getAllDeckNames().size() << std::endl;
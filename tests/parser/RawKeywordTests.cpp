@@ -100,3 +100,40 @@ BOOST_AUTO_TEST_CASE(IsFinished) {
 }
 
 
+
+BOOST_AUTO_TEST_CASE(RawRecordTokens) {
+    std::string storage = "  1 'A B'\t3*7  4 ";
+    RawRecord rec(std::string_view(storage), KeywordLocation("KW", "file", 100));
+
+    BOOST_CHECK_EQUAL(rec.size(), 4U);
+    BOOST_CHECK_EQUAL(rec.max_size(), 4U);
+    BOOST_CHECK_EQUAL(rec.getItem(1), "'A B'");
+    BOOST_CHECK_EQUAL(rec.getItem(3), "4");
+    BOOST_CHECK_THROW(rec.getItem(4), std::out_of_range);
+
+    BOOST_CHECK_EQUAL(rec.front(), "1");
+    BOOST_CHECK_EQUAL(rec.pop_front(), "1");
+    BOOST_CHECK_EQUAL(rec.pop_front(), "'A B'");
+    BOOST_CHECK_EQUAL(rec.pop_front(), "3*7");
+    BOOST_CHECK_EQUAL(rec.size(), 1U);
+
+    rec.push_front("7", 2);
+    rec.push_front("X", 0);
+    BOOST_CHECK_EQUAL(rec.size(), 3U);
+    BOOST_CHECK_EQUAL(rec.max_size(), 6U);
+    BOOST_CHECK_EQUAL(rec.getItem(1), "7");
+    BOOST_CHECK_EQUAL(rec.getItem(2), "4");
+
+    BOOST_CHECK_EQUAL(rec.pop_front(), "7");
+    BOOST_CHECK_EQUAL(rec.pop_front(), "7");
+    BOOST_CHECK_EQUAL(rec.pop_front(), "4");
+    BOOST_CHECK_EQUAL(rec.size(), 0U);
+
+    RawRecord text(std::string_view(storage), KeywordLocation("KW", "file", 100), true);
+    BOOST_CHECK_EQUAL(text.size(), 1U);
+    BOOST_CHECK_EQUAL(text.pop_front(), storage);
+    BOOST_CHECK_EQUAL(text.size(), 0U);
+
+    std::string unbalanced = "1 'A";
+    BOOST_CHECK_THROW(RawRecord(std::string_view(unbalanced), KeywordLocation("KW", "file", 100)), std::exception);
+}
@@ -149,4 +149,26 @@ BOOST_AUTO_TEST_CASE(match_test) {
     BOOST_CHECK( !shmatch("NAME.*", "NAME") );
 }
 
+BOOST_AUTO_TEST_CASE(compiled_pattern) {
+    const std::vector<std::string> patterns {
+        "NAME*", "NAME", "NAME?ABC", "*", "*ABC", "N*E*C", "N*E*C*", "?A*", "A*A",
+        "NAME[0-9][0-9]", "",
+    };
+
+    const std::vector<std::string> symbols {
+        "NAME", "NAMEABC", "NONAMEABC", "NAMEXABC", "NAME13", "NAME13X",
+        "NAME.EXT", "NAME.", "A", "AA", "ABA", "", "NEC", "NECX",
+    };
+
+    for (const auto& pattern : patterns) {
+        const ShellPattern compiled(pattern);
+        for (const auto& symbol : symbols)
+            BOOST_CHECK_MESSAGE(compiled.match(symbol) == shmatch(pattern, symbol),
+                                "Pattern '" << pattern << "' and symbol '" << symbol << "'");
+    }
+
+    BOOST_CHECK( ShellPattern("NAME").is_literal() );
+    BOOST_CHECK( !ShellPattern("NAME*").is_literal() );
+}
+
 
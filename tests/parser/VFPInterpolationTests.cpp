@@ -0,0 +1,184 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define BOOST_TEST_MODULE VFPInterpolationTests
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/input/eclipse/Schedule/VFPInterpolation.hpp>
+#include <opm/input/eclipse/Schedule/VFPInjTable.hpp>
+#include <opm/input/eclipse/Schedule/VFPProdTable.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Units/UnitSystem.hpp>
+
+#include <vector>
+
+namespace {
+
+// Multilinear in each variable, hence reproduced exactly by the interpolation.
+double bhpFunction(double thp, double wfr, double gfr, double alq, double flo)
+{
+    return 1.0e5 + 2.0*thp + 3.0e5*wfr + 1.0e3*gfr + 10.0*alq + 1.0e6*flo
+        + 0.5*thp*flo + 7.0*wfr*gfr*alq;
+}
+
+Opm::VFPProdTable makeProdTable()
+{
+    const std::vector<double> thp {1.0e5, 2.0e5, 5.0e5};
+    const std::vector<double> wfr {0.0, 0.5, 1.0};
+    const std::vector<double> gfr {10.0, 100.0};
+    const std::vector<double> alq {0.0, 5.0};
+    const std::vector<double> flo {0.01, 0.02, 0.05, 0.1};
+
+    std::vector<double> data;
+    for (const auto t : thp) {
+        for (const auto w : wfr) {
+            for (const auto g : gfr) {
+                for (const auto a : alq) {
+                    for (const auto f : flo) {
+                        data.push_back(bhpFunction(t, w, g, a, f));
+                    }
+                }
+            }
+        }
+    }
+
+    return { 1, 1000.0,
+             Opm::VFPProdTable::FLO_TYPE::FLO_OIL,
+             Opm::VFPProdTable::WFR_TYPE::WFR_WCT,
+             Opm::VFPProdTable::GFR_TYPE::GFR_GOR,
+             Opm::VFPProdTable::ALQ_TYPE::ALQ_GRAT,
+             flo, thp, wfr, gfr, alq, data };
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(VFPAxisLocate)
+{
+    const Opm::VFPAxis axis({1.0, 2.0, 2.0, 4.0, 8.0});
+
+    const auto below = axis.locate(0.0);
+    BOOST_CHECK_EQUAL(below.index, 0U);
+    BOOST_CHECK_CLOSE(below.factor, -1.0, 1.0e-12);
+
+    const auto inside = axis.locate(3.0);
+    BOOST_CHECK_EQUAL(inside.index, 2U);
+    BOOST_CHECK_CLOSE(inside.factor, 0.5, 1.0e-12);
+    BOOST_CHECK_CLOSE(inside.inv_dx, 0.5, 1.0e-12);
+
+    const auto above = axis.locate(10.0);
+    BOOST_CHECK_EQUAL(above.index, 3U);
+    BOOST_CHECK_CLOSE(above.factor, 1.5, 1.0e-12);
+
+    // Hint is used if it contains the value, and ignored otherwise.
+    BOOST_CHECK_EQUAL(axis.locate(5.0, 3).index, 3U);
+    BOOST_CHECK_EQUAL(axis.locate(5.0, 0).index, 3U);
+
+    const Opm::VFPAxis single({3.0});
+    BOOST_CHECK_EQUAL(single.locate(7.0).index, 0U);
+    BOOST_CHECK_EQUAL(single.locate(7.0).factor, 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(VFPProdInterpolate)
+{
+    const auto table = makeProdTable();
+    const Opm::VFPProdInterpolator interp(table);
+
+    const std::vector<Opm::VFPProdInterpolator::Point> points {
+        {1.5e5, 0.25, 40.0, 1.0, 0.015},
+        {1.6e5, 0.30, 45.0, 1.5, 0.018},   // same cell as the previous point
+        {4.0e5, 0.75, 90.0, 4.0, 0.070},
+        {6.0e5, 1.20, 120.0, 6.0, 0.200},  // extrapolation
+    };
+
+    Opm::VFPProdInterpolator::Hint hint;
+    for (const auto& p : points) {
+        const auto expected = bhpFunction(p.thp, p.wfr, p.gfr, p.alq, p.flo);
+        const auto eval = interp.bhp(p, hint);
+        BOOST_CHECK_CLOSE(eval.value, expected, 1.0e-10);
+        BOOST_CHECK_CLOSE(interp.bhp(p).value, expected, 1.0e-10);
+
+        BOOST_CHECK_CLOSE(eval.dthp, 2.0 + 0.5*p.flo, 1.0e-8);
+        BOOST_CHECK_CLOSE(eval.dwfr, 3.0e5 + 7.0*p.gfr*p.alq, 1.0e-8);
+        BOOST_CHECK_CLOSE(eval.dgfr, 1.0e3 + 7.0*p.wfr*p.alq, 1.0e-8);
+        BOOST_CHECK_CLOSE(eval.dalq, 10.0 + 7.0*p.wfr*p.gfr, 1.0e-8);
+        BOOST_CHECK_CLOSE(eval.dflo, 1.0e6 + 0.5*p.thp, 1.0e-8);
+    }
+
+    std::vector<Opm::VFPProdInterpolator::Hint> hints;
+    std::vector<Opm::VFPEvaluation> result;
+    interp.bhp(points, hints, result);
+    BOOST_REQUIRE_EQUAL(result.size(), points.size());
+    BOOST_REQUIRE_EQUAL(hints.size(), points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        BOOST_CHECK_EQUAL(result[i].value, interp.bhp(points[i]).value);
+        BOOST_CHECK(hints[i].valid);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(VFPProdInverse)
+{
+    const auto table = makeProdTable();
+    const Opm::VFPProdInterpolator interp(table);
+
+    const Opm::VFPProdInterpolator::Point p {3.0e5, 0.3, 50.0, 2.0, 0.04};
+    const auto bhp = interp.bhp(p).value;
+
+    BOOST_CHECK_CLOSE(interp.thp(bhp, p), p.thp, 1.0e-8);
+
+    const auto flo = interp.flo(bhp, p);
+    BOOST_REQUIRE(flo.has_value());
+    BOOST_CHECK_CLOSE(*flo, p.flo, 1.0e-8);
+
+    // Below the smallest BHP in the table at this THP.
+    BOOST_CHECK(!interp.flo(1.0e5, p).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(VFPInjInterpolate)
+{
+    const auto deck = Opm::Parser{}.parseString(R"(
+VFPINJ
+-- Table Depth  Rate   TAB  UNITS  BODY
+       5  32.9   WAT   THP METRIC   BHP /
+-- Rate axis
+1 3 5 /
+-- THP axis
+7 11 /
+-- Table data with THP# <values 1-num_rates>
+1 1.5 2.5 3.5 /
+2 4.5 5.5 6.5 /
+)");
+
+    const Opm::VFPInjTable table(deck["VFPINJ"].back(), Opm::UnitSystem::newMETRIC());
+    const Opm::VFPInjInterpolator interp(table);
+
+    const double day = 86400.0;
+    const double bar = 1.0e5;
+
+    const auto eval = interp.bhp(9.0*bar, 2.0/day);
+    BOOST_CHECK_CLOSE(eval.value, 3.5*bar, 1.0e-10);
+    BOOST_CHECK_CLOSE(eval.dthp, 0.75, 1.0e-10);
+    BOOST_CHECK_CLOSE(eval.dflo, 0.5*bar*day, 1.0e-10);
+
+    BOOST_CHECK_CLOSE(interp.thp(3.5*bar, 2.0/day), 9.0*bar, 1.0e-10);
+
+    const auto flo = interp.flo(3.5*bar, 9.0*bar);
+    BOOST_REQUIRE(flo.has_value());
+    BOOST_CHECK_CLOSE(*flo, 2.0/day, 1.0e-10);
+}
@@ -91,6 +91,46 @@ BOOST_AUTO_TEST_CASE(WLISTManager) {
 }
 
 
+BOOST_AUTO_TEST_CASE(WLISTManagerPatternUpdate) {
+    Opm::WListManager wlm;
+    wlm.newList("*LIST1", {"W1", "W2"});
+    wlm.newList("*LIST2", {"W3"});
+
+    const auto sorted = [](std::vector<std::string> wells)
+    {
+        std::sort(wells.begin(), wells.end());
+        return wells;
+    };
+
+    using Wells = std::vector<std::string>;
+    BOOST_CHECK(sorted(wlm.wells("*LIST*")) == Wells({"W1", "W2", "W3"}));
+    BOOST_CHECK(sorted(wlm.wells("*LIST*")) == Wells({"W1", "W2", "W3"}));
+
+    // Pattern results follow every change of the well lists.
+    wlm.addWListWell("W4", "*LIST2");
+    BOOST_CHECK(sorted(wlm.wells("*LIST*")) == Wells({"W1", "W2", "W3", "W4"}));
+
+    wlm.delWListWell("W1", "*LIST1");
+    BOOST_CHECK(sorted(wlm.wells("*LIST*")) == Wells({"W2", "W3", "W4"}));
+
+    wlm.delWell("W3");
+    BOOST_CHECK(sorted(wlm.wells("*LIST*")) == Wells({"W2", "W4"}));
+
+    wlm.newList("*LIST3", {"W5"});
+    BOOST_CHECK(sorted(wlm.wells("*LIST*")) == Wells({"W2", "W4", "W5"}));
+
+    wlm.getList("*LIST3").add("W6");
+    BOOST_CHECK(sorted(wlm.wells("*LIST*")) == Wells({"W2", "W4", "W5", "W6"}));
+    BOOST_CHECK(sorted(wlm.wells("*LIST3")) == Wells({"W5", "W6"}));
+
+    // Copies carry consistent results.
+    auto copy = wlm;
+    copy.newList("*LIST1", {});
+    BOOST_CHECK(sorted(copy.wells("*LIST*")) == Wells({"W4", "W5", "W6"}));
+    BOOST_CHECK(sorted(wlm.wells("*LIST*")) == Wells({"W2", "W4", "W5", "W6"}));
+}
+
+
 static std::string WELSPECS() {
     return
         "WELSPECS\n"
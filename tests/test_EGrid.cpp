@@ -36,6 +36,7 @@
 #include <math.h>
 #include <stdio.h>
 #include <tuple>
+#include <vector>
 
 using Opm::EclIO::EGrid;
 
@@ -163,6 +164,58 @@ BOOST_AUTO_TEST_CASE(getCellCorners)
     BOOST_CHECK_EQUAL(Z == ref_Z, true);
 }
 
+BOOST_AUTO_TEST_CASE(BulkCellGeometry)
+{
+    EGrid grid1("SPE1CASE1.EGRID");
+
+    const auto cells = grid1.layerCells(1, 2);
+    BOOST_CHECK_EQUAL(cells.size(), 200U);
+    BOOST_CHECK_EQUAL(cells.front(), grid1.global_index(0, 0, 1));
+    BOOST_CHECK_EQUAL(cells.back(), grid1.global_index(9, 9, 2));
+    BOOST_CHECK_EQUAL(grid1.layerCells(0, 2, true).size(),
+                      static_cast<std::size_t>(grid1.activeCells()));
+    BOOST_CHECK_THROW(grid1.layerCells(2, 1), std::invalid_argument);
+
+    std::vector<std::array<double,8>> X, Y, Z;
+    std::vector<double> volume, depth;
+    std::vector<std::array<double,3>> center;
+
+    grid1.getCellCorners(cells, X, Y, Z);
+    grid1.getCellVolumes(cells, volume);
+    grid1.getCellCenters(cells, center);
+    grid1.getCellDepths(cells, depth);
+
+    BOOST_REQUIRE_EQUAL(X.size(), cells.size());
+    BOOST_REQUIRE_EQUAL(volume.size(), cells.size());
+    BOOST_REQUIRE_EQUAL(center.size(), cells.size());
+    BOOST_REQUIRE_EQUAL(depth.size(), cells.size());
+
+    for (std::size_t n = 0; n < cells.size(); n++) {
+        std::array<double,8> X1, Y1, Z1;
+        grid1.getCellCorners(cells[n], X1, Y1, Z1);
+
+        BOOST_CHECK(X[n] == X1);
+        BOOST_CHECK(Y[n] == Y1);
+        BOOST_CHECK(Z[n] == Z1);
+
+        BOOST_CHECK_CLOSE(volume[n], calculateCellVol(X1, Y1, Z1), 1.0e-12);
+        BOOST_CHECK_CLOSE(center[n][2], depth[n], 1.0e-12);
+    }
+
+    // cell 4,3,2 => zero based 3,2,1
+    const auto ind = static_cast<std::size_t>(grid1.global_index(3, 2, 1) - cells.front());
+    BOOST_CHECK_CLOSE(center[ind][0], 3500.0, 1.0e-12);
+    BOOST_CHECK_CLOSE(center[ind][1], 2500.0, 1.0e-12);
+    BOOST_CHECK_CLOSE(depth[ind], 8360.0, 1.0e-12);
+
+    // Output buffers are reused and resized.
+    grid1.getCellVolumes({0}, volume);
+    BOOST_CHECK_EQUAL(volume.size(), 1U);
+
+    BOOST_CHECK_THROW(grid1.getCellVolumes({-1}, volume), std::invalid_argument);
+    BOOST_CHECK_THROW(grid1.getCellDepths({grid1.totalNumberOfCells()}, depth), std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_CASE(lgr_1)
 {
     std::string testEgridFile = "LGR_TESTMOD.EGRID";
@@ -320,6 +320,25 @@ BOOST_AUTO_TEST_CASE(TestERst_4) {
 }
 
 
+BOOST_AUTO_TEST_CASE(TestERst_Unload) {
+
+    ERst rst1("SPE1_TESTCASE.UNRST");
+    rst1.loadReportStepNumber(25);
+
+    const std::vector<float> pres = rst1.getRestartData<float>("PRESSURE", 25, 0);
+
+    // Unloaded arrays are read again on demand.
+    rst1.unloadReportStepNumber(25);
+    BOOST_CHECK(rst1.getRestartData<float>("PRESSURE", 25, 0) == pres);
+
+    rst1.unloadReportStepNumber(25);
+    rst1.loadReportStepNumber(25);
+    BOOST_CHECK(rst1.getRestartData<float>("PRESSURE", 25, 0) == pres);
+
+    BOOST_CHECK_THROW(rst1.unloadReportStepNumber(4), std::invalid_argument);
+}
+
+
 BOOST_AUTO_TEST_CASE(TestERst_5a) {
 
     std::string testRstFile = "LGR_TESTMOD.X0002";
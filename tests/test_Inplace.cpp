@@ -66,6 +66,53 @@ BOOST_AUTO_TEST_CASE(TESTInplace)
     }
 }
 
+BOOST_AUTO_TEST_CASE(InPlace_RegionSums)
+{
+    const std::vector<int> fipnum { 1, 2, 2, 0, 4, 1, 5, 4 };
+    const std::vector<double> values { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0 };
+
+    const auto sums = Inplace::regionSums(fipnum, values, 4);
+    const std::vector<double> expect = { 7.0, 5.0, 0.0, 13.0 };
+    BOOST_CHECK_MESSAGE(sums == expect, "Region sums must match expected");
+
+    BOOST_CHECK_THROW(Inplace::regionSums(fipnum, { 1.0 }, 4), std::invalid_argument);
+
+    // Many cells, split across several blocks.
+    const std::size_t num_cells = 100'000;
+    std::vector<int> region(num_cells);
+    for (std::size_t cell = 0; cell < num_cells; ++cell) {
+        region[cell] = 1 + cell % 3;
+    }
+
+    const auto large = Inplace::regionSums(region, std::vector<double>(num_cells, 0.5), 3);
+    BOOST_CHECK_CLOSE(large[0], 0.5 * 33'334, 1.0e-12);
+    BOOST_CHECK_CLOSE(large[1], 0.5 * 33'333, 1.0e-12);
+    BOOST_CHECK_CLOSE(large[2], 0.5 * 33'333, 1.0e-12);
+
+    // More regions than cells per block.
+    std::vector<int> unique_region(num_cells);
+    for (std::size_t cell = 0; cell < num_cells; ++cell) {
+        unique_region[cell] = static_cast<int>(num_cells - cell);
+    }
+
+    const auto per_cell = Inplace::regionSums(unique_region, std::vector<double>(num_cells, 0.5), num_cells);
+    BOOST_CHECK(per_cell == std::vector<double>(num_cells, 0.5));
+
+    Inplace oip;
+    oip.add("FIPNUM", Inplace::Phase::PoreVolume, sums);
+    BOOST_CHECK_EQUAL(oip.max_region("FIPNUM"), 4);
+    BOOST_CHECK_EQUAL(oip.get("FIPNUM", Inplace::Phase::PoreVolume, 4), 13.0);
+    BOOST_CHECK(oip.has("FIPNUM", Inplace::Phase::PoreVolume, 3));
+    BOOST_CHECK(!oip.has("FIPNUM", Inplace::Phase::PoreVolume, 5));
+    BOOST_CHECK(oip.get_vector("FIPNUM", Inplace::Phase::PoreVolume) == expect);
+
+    Inplace other;
+    for (std::size_t region_id = 1; region_id <= sums.size(); ++region_id) {
+        other.add("FIPNUM", Inplace::Phase::PoreVolume, region_id, sums[region_id - 1]);
+    }
+    BOOST_CHECK(oip == other);
+}
+
 BOOST_AUTO_TEST_CASE(InPlace_Phases)
 {
     const auto& phases = Inplace::phases();
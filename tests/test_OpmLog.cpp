@@ -28,6 +28,8 @@
 #include <stdexcept>
 #include <iostream>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 
 #include <opm/common/OpmLog/OpmLog.hpp>
@@ -424,3 +426,128 @@ BOOST_AUTO_TEST_CASE(TestFormat)
     BOOST_CHECK_EQUAL(log_stream2.str(), expected2);
     BOOST_CHECK_EQUAL(log_stream3.str(), expected3);
 }
+
+
+BOOST_AUTO_TEST_CASE(TestCaptureScope)
+{
+    OpmLog::removeAllBackends();
+    std::ostringstream log_stream;
+    OpmLog::addBackend("STREAM", std::make_shared<StreamLog>(log_stream, Log::DefaultMessageTypes));
+
+    std::vector<OpmLog::CapturedMessage> captured;
+    std::thread worker([&captured]() {
+        OpmLog::CaptureScope capture(captured);
+        OpmLog::warning("worker 1");
+        OpmLog::info("tag", "worker 2");
+    });
+    worker.join();
+
+    // Messages from the main thread are not captured.
+    OpmLog::warning("main");
+    BOOST_CHECK_EQUAL(log_stream.str(), "main\n");
+    BOOST_REQUIRE_EQUAL(captured.size(), 2U);
+    BOOST_CHECK_EQUAL(captured[1].tag, "tag");
+
+    OpmLog::replay(captured);
+    BOOST_CHECK_EQUAL(log_stream.str(), "main\nworker 1\nworker 2\n");
+
+    {
+        std::vector<OpmLog::CapturedMessage> outer;
+        OpmLog::CaptureScope capture(outer);
+        OpmLog::error("captured");
+        BOOST_CHECK_EQUAL(outer.size(), 1U);
+    }
+    OpmLog::error("not captured");
+    BOOST_CHECK_EQUAL(log_stream.str(), "main\nworker 1\nworker 2\nnot captured\n");
+}
+
+
+BOOST_AUTO_TEST_CASE(TestConcurrentLogging)
+{
+    OpmLog::removeAllBackends();
+    BOOST_CHECK(!OpmLog::isActive(Log::MessageType::Info));
+
+    std::ostringstream log_stream;
+    auto counter = std::make_shared<CounterLog>(Log::DefaultMessageTypes);
+    OpmLog::addBackend("STREAM", std::make_shared<StreamLog>(log_stream, Log::MessageType::Warning));
+    OpmLog::addBackend("COUNTER", counter);
+    BOOST_CHECK(OpmLog::isActive(Log::MessageType::Info));
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([]() {
+            for (int i = 0; i < 250; ++i) {
+                OpmLog::warning("message");
+                OpmLog::info("message");
+            }
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+
+    BOOST_CHECK_EQUAL(counter->numMessages(Log::MessageType::Warning), 1000U);
+    BOOST_CHECK_EQUAL(counter->numMessages(Log::MessageType::Info), 1000U);
+
+    std::string expected;
+    for (int i = 0; i < 1000; ++i)
+        expected += "message\n";
+    BOOST_CHECK_EQUAL(log_stream.str(), expected);
+}
+
+
+namespace {
+    // Only shows the text written to the stream once it has been flushed.
+    class FlushRecorder : public std::stringbuf {
+    public:
+        int flushes = 0;
+        std::string flushed;
+
+    protected:
+        int sync() override {
+            ++flushes;
+            flushed = str();
+            return 0;
+        }
+    };
+}
+
+BOOST_AUTO_TEST_CASE(TestStreamLogBatching)
+{
+    FlushRecorder buffer;
+    std::ostream os(&buffer);
+    std::string expected;
+    {
+        StreamLog streamLog(os, Log::DefaultMessageTypes);
+
+        for (std::size_t i = 0; i + 1 < StreamLog::flushLines; ++i) {
+            streamLog.addMessage(Log::MessageType::Info, std::to_string(i));
+            expected += std::to_string(i) + '\n';
+        }
+        BOOST_CHECK_EQUAL(buffer.flushes, 0);
+
+        streamLog.addMessage(Log::MessageType::Info, "last");
+        expected += "last\n";
+        BOOST_CHECK_EQUAL(buffer.flushes, 1);
+        BOOST_CHECK_EQUAL(buffer.flushed, expected);
+
+        streamLog.addMessage(Log::MessageType::Info, "info");
+        streamLog.addMessage(Log::MessageType::Warning, "warning");
+        expected += "info\n";
+        expected += "warning\n";
+        BOOST_CHECK_EQUAL(buffer.flushes, 2);
+        BOOST_CHECK_EQUAL(buffer.flushed, expected);
+
+        streamLog.addMessage(Log::MessageType::Note, "note");
+        expected += "note\n";
+        BOOST_CHECK_EQUAL(buffer.flushes, 2);
+
+        streamLog.flush();
+        BOOST_CHECK_EQUAL(buffer.flushes, 3);
+        BOOST_CHECK_EQUAL(buffer.flushed, expected);
+
+        streamLog.addMessage(Log::MessageType::Debug, "debug");
+        expected += "debug\n";
+    }
+    BOOST_CHECK_EQUAL(buffer.flushes, 4);
+    BOOST_CHECK_EQUAL(buffer.flushed, expected);
+}
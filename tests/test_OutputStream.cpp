@@ -29,12 +29,19 @@
 #include <opm/io/eclipse/PaddedOutputString.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
+#include <opm/common/OpmLog/CounterLog.hpp>
+#include <opm/common/OpmLog/LogUtil.hpp>
+#include <opm/common/OpmLog/OpmLog.hpp>
+
 #include <opm/io/eclipse/EclIOdata.hpp>
 
 #include <algorithm>
 #include <chrono>
 #include <ctime>
+#include <filesystem>
+#include <fstream>
 #include <iterator>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <tuple>
@@ -812,6 +819,192 @@ BOOST_AUTO_TEST_CASE(Unformatted_Unified)
     }
 }
 
+BOOST_AUTO_TEST_CASE(Unformatted_Unified_Index)
+{
+    const auto rset = RSet("CASE");
+    const auto fmt  = ::Opm::EclIO::OutputStream::Formatted{ false };
+    const auto unif = ::Opm::EclIO::OutputStream::Unified  { true };
+    const auto idx  = ::Opm::EclIO::OutputStream::Indexed  { true };
+
+    const auto fname = ::Opm::EclIO::OutputStream::
+        outputFileName(rset, "UNRST");
+
+    const auto indexFile = ::Opm::EclIO::EclFile::indexFileName(fname);
+
+    auto indexArrays = [&indexFile]()
+    {
+        return ::Opm::EclIO::EclFile{ indexFile }.size();
+    };
+
+    for (const auto seqnum : { 1, 2, 3 }) {
+        auto rst = ::Opm::EclIO::OutputStream::Restart {
+            rset, seqnum, fmt, unif, idx
+        };
+
+        rst.write("I", std::vector<int>   (seqnum, seqnum));
+        rst.write("D", std::vector<double>{2.71, 8.21});
+    }
+
+    // One block of seven arrays appended per report step
+    BOOST_CHECK_EQUAL(indexArrays(), 3 * 7U);
+
+    {
+        auto rst = ::Opm::EclIO::OutputStream::Restart {
+            rset, 2, fmt, unif, idx
+        };
+
+        rst.write("I", std::vector<int>   (2, 2));
+        rst.write("D", std::vector<double>{2.71, 8.21});
+    }
+
+    // Overwriting a report step rewrites the index as a single block
+    BOOST_CHECK_EQUAL(indexArrays(), 7U);
+
+    BOOST_CHECK_MESSAGE(::Opm::EclIO::EclFile::hasValidIndex(fname),
+                        "Restart file must have an up to date index");
+
+    const auto expect_vectors = std::vector<Opm::EclIO::EclFile::EclEntry>{
+        Opm::EclIO::EclFile::EclEntry{"SEQNUM", Opm::EclIO::eclArrType::INTE, 1},
+        Opm::EclIO::EclFile::EclEntry{"I", Opm::EclIO::eclArrType::INTE, 2},
+        Opm::EclIO::EclFile::EclEntry{"D", Opm::EclIO::eclArrType::DOUB, 2},
+    };
+
+    {
+        auto rst = ::Opm::EclIO::ERst{fname};
+
+        const auto seqnum        = rst.listOfReportStepNumbers();
+        const auto expect_seqnum = std::vector<int>{1, 2};
+        BOOST_CHECK_EQUAL_COLLECTIONS(seqnum.begin(), seqnum.end(),
+                                      expect_seqnum.begin(),
+                                      expect_seqnum.end());
+
+        const auto vectors = rst.listOfRstArrays(2);
+        BOOST_CHECK_EQUAL_COLLECTIONS(vectors.begin(), vectors.end(),
+                                      expect_vectors.begin(),
+                                      expect_vectors.end());
+
+        const auto& I = rst.getRestartData<int>("I", 2, 0);
+        BOOST_CHECK_EQUAL(I.size(), 2U);
+        BOOST_CHECK_EQUAL(I[1], 2);
+    }
+
+    // Index built after the fact
+    std::filesystem::remove(indexFile);
+    BOOST_CHECK(! ::Opm::EclIO::EclFile::hasValidIndex(fname));
+
+    ::Opm::EclIO::EclFile::writeIndex(fname);
+    BOOST_CHECK(::Opm::EclIO::EclFile::hasValidIndex(fname));
+
+    // Index of file modified in place is ignored
+    {
+        const auto mtime = std::filesystem::last_write_time(fname);
+
+        std::filesystem::last_write_time(fname, mtime + std::chrono::seconds{10});
+        BOOST_CHECK(! ::Opm::EclIO::EclFile::hasValidIndex(fname));
+
+        std::filesystem::last_write_time(fname, mtime);
+        BOOST_CHECK(::Opm::EclIO::EclFile::hasValidIndex(fname));
+
+        // Rename the first array without changing the file's size or
+        // modification time.
+        {
+            std::fstream file(fname, std::ios::in | std::ios::out | std::ios::binary);
+            file.seekp(4);
+            file.write("SEQNUMX ", 8);
+        }
+        std::filesystem::last_write_time(fname, mtime);
+        BOOST_CHECK(! ::Opm::EclIO::EclFile::hasValidIndex(fname));
+
+        {
+            std::fstream file(fname, std::ios::in | std::ios::out | std::ios::binary);
+            file.seekp(4);
+            file.write("SEQNUM  ", 8);
+        }
+        std::filesystem::last_write_time(fname, mtime);
+        BOOST_CHECK(::Opm::EclIO::EclFile::hasValidIndex(fname));
+    }
+
+    // Out of date index is ignored
+    {
+        auto out = ::Opm::EclIO::EclOutput{ fname, false, std::ios::app };
+        out.write("SEQNUM", std::vector<int>{ 4 });
+        out.write("I", std::vector<int>{ 4, 4 });
+    }
+
+    BOOST_CHECK(! ::Opm::EclIO::EclFile::hasValidIndex(fname));
+
+    {
+        auto rst = ::Opm::EclIO::ERst{fname};
+        BOOST_CHECK(rst.hasReportStepNumber(4));
+        BOOST_CHECK_EQUAL(rst.getRestartData<int>("I", 4, 0)[1], 4);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Unformatted_Unified_Index_Move_Assign)
+{
+    const auto rset1 = RSet("CASE1");
+    const auto rset2 = RSet("CASE2");
+    const auto fmt  = ::Opm::EclIO::OutputStream::Formatted{ false };
+    const auto unif = ::Opm::EclIO::OutputStream::Unified  { true };
+    const auto idx  = ::Opm::EclIO::OutputStream::Indexed  { true };
+
+    const auto fname1 = ::Opm::EclIO::OutputStream::outputFileName(rset1, "UNRST");
+    const auto fname2 = ::Opm::EclIO::OutputStream::outputFileName(rset2, "UNRST");
+
+    auto rst = ::Opm::EclIO::OutputStream::Restart { rset1, 1, fmt, unif, idx };
+    rst.write("I", std::vector<int>{ 1, 2, 3 });
+
+    // Assigning a new stream completes the report step of the old one
+    rst = ::Opm::EclIO::OutputStream::Restart { rset2, 1, fmt, unif, idx };
+    BOOST_CHECK(::Opm::EclIO::EclFile::hasValidIndex(fname1));
+
+    rst.write("I", std::vector<int>{ 4, 5 });
+    {
+        auto done = std::move(rst);
+    }
+    BOOST_CHECK(::Opm::EclIO::EclFile::hasValidIndex(fname2));
+
+    const auto& I = ::Opm::EclIO::ERst{fname1}.getRestartData<int>("I", 1, 0);
+    BOOST_CHECK_EQUAL(I.size(), 3U);
+}
+
+BOOST_AUTO_TEST_CASE(Unformatted_Unified_Index_Optional)
+{
+    const auto rset = RSet("CASE");
+    const auto fmt  = ::Opm::EclIO::OutputStream::Formatted{ false };
+    const auto unif = ::Opm::EclIO::OutputStream::Unified  { true };
+
+    const auto fname = ::Opm::EclIO::OutputStream::outputFileName(rset, "UNRST");
+    const auto indexFile = ::Opm::EclIO::EclFile::indexFileName(fname);
+
+    // No index unless requested
+    {
+        auto rst = ::Opm::EclIO::OutputStream::Restart { rset, 1, fmt, unif };
+        rst.write("I", std::vector<int>{ 1, 2, 3 });
+    }
+    BOOST_CHECK(! std::filesystem::exists(indexFile));
+
+    // Failure to write the index is reported, but does not fail the
+    // restart output.
+    std::filesystem::create_directory(indexFile);
+
+    auto counter = std::make_shared<::Opm::CounterLog>();
+    ::Opm::OpmLog::addBackend("COUNTER", counter);
+    {
+        auto rst = ::Opm::EclIO::OutputStream::Restart {
+            rset, 2, fmt, unif, ::Opm::EclIO::OutputStream::Indexed{ true }
+        };
+        rst.write("I", std::vector<int>{ 4, 5 });
+    }
+    ::Opm::OpmLog::removeBackend("COUNTER");
+
+    BOOST_CHECK_EQUAL(counter->numMessages(::Opm::Log::MessageType::Warning), 1U);
+    BOOST_CHECK(! ::Opm::EclIO::EclFile::hasValidIndex(fname));
+
+    const auto& I = ::Opm::EclIO::ERst{fname}.getRestartData<int>("I", 2, 0);
+    BOOST_CHECK_EQUAL(I.size(), 2U);
+}
+
 BOOST_AUTO_TEST_CASE(Formatted_Separate)
 {
     const auto rset = RSet("CASE.T01.");
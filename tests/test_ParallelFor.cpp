@@ -0,0 +1,69 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE PARALLEL_FOR_TESTS
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/utility/ParallelFor.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+BOOST_AUTO_TEST_CASE(AllIndicesVisited)
+{
+    auto visits = std::vector<int>(1000, 0);
+
+    Opm::parallelFor(visits.size(), [&visits](const std::size_t i)
+    {
+        visits[i] += static_cast<int>(i) + 1;
+    });
+
+    for (std::size_t i = 0; i < visits.size(); ++i) {
+        BOOST_CHECK_EQUAL(visits[i], static_cast<int>(i) + 1);
+    }
+
+    Opm::parallelFor(0, [](const std::size_t) { throw std::logic_error("Empty range"); });
+}
+
+BOOST_AUTO_TEST_CASE(FirstExceptionRethrown)
+{
+    auto visits = std::vector<int>(100, 0);
+
+    try {
+        Opm::parallelFor(visits.size(), [&visits](const std::size_t i)
+        {
+            visits[i] = 1;
+
+            if ((i == 17) || (i == 42) || (i == 99)) {
+                throw std::invalid_argument(std::to_string(i));
+            }
+        });
+
+        BOOST_FAIL("parallelFor() must rethrow");
+    }
+    catch (const std::invalid_argument& e) {
+        BOOST_CHECK_EQUAL(std::string { e.what() }, "17");
+    }
+
+    for (const auto& v : visits) {
+        BOOST_CHECK_EQUAL(v, 1);
+    }
+}
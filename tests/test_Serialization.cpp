@@ -33,6 +33,9 @@
 #include <opm/input/eclipse/Deck/Deck.hpp>
 #include <opm/input/eclipse/Deck/DeckItem.hpp>
 
+#include <opm/input/eclipse/Parser/Parser.hpp>
+
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Aquifer/Aquancon.hpp>
 #include <opm/input/eclipse/EclipseState/Aquifer/AquiferCT.hpp>
 #include <opm/input/eclipse/EclipseState/Aquifer/AquiferConfig.hpp>
@@ -153,10 +156,17 @@
 #include <opm/input/eclipse/Schedule/WriteRestartFileEvents.hpp>
 
 #include <opm/common/utility/Serializer.hpp>
+#include <opm/common/utility/SerializedImage.hpp>
 #include <opm/common/utility/MemPacker.hpp>
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
 #include <memory>
+#include <string>
 #include <tuple>
+#include <vector>
 #include <utility>
 
 namespace {
@@ -362,6 +372,389 @@ TEST_FOR_TYPE(WriteRestartFileEvents)
 TEST_FOR_TYPE(WCYCLE)
 TEST_FOR_TYPE(EzrokhiTable)
 
+BOOST_AUTO_TEST_CASE(RepeatedPack)
+{
+    Opm::Serialization::MemPacker packer;
+    Opm::Serializer ser(packer);
+
+    // The buffer grows while packing.  Packing a smaller object
+    // afterwards must not leave stale data from the larger one.
+    const auto large = std::vector<double>(100'000, 1.5);
+    ser.pack(large, std::string("large"));
+    const auto largeSize = ser.position();
+    BOOST_CHECK_EQUAL(largeSize, 2*sizeof(std::size_t) + large.size()*sizeof(double) + 5);
+
+    const auto small = std::vector<double> { 1.0, 2.0, 3.0 };
+    ser.pack(small, std::string("small"));
+    const auto smallSize = ser.position();
+    BOOST_CHECK_EQUAL(smallSize, 2*sizeof(std::size_t) + small.size()*sizeof(double) + 5);
+
+    auto out = std::vector<double>{};
+    auto name = std::string{};
+    ser.unpack(out, name);
+    BOOST_CHECK_EQUAL(ser.position(), smallSize);
+    BOOST_CHECK_EQUAL(name, "small");
+    BOOST_CHECK_EQUAL_COLLECTIONS(out.begin(), out.end(), small.begin(), small.end());
+}
+
+namespace {
+
+// Records the largest buffer capacity seen while packing.
+struct CapacityPacker : Opm::Serialization::MemPacker
+{
+    template<class T>
+    void pack(const T& data, std::vector<char>& buffer, std::size_t& position) const
+    {
+        maxCapacity = std::max(maxCapacity, buffer.capacity());
+        Opm::Serialization::MemPacker::pack(data, buffer, position);
+    }
+
+    template<class T>
+    void pack(const T* data, std::size_t n, std::vector<char>& buffer, std::size_t& position) const
+    {
+        maxCapacity = std::max(maxCapacity, buffer.capacity());
+        Opm::Serialization::MemPacker::pack(data, n, buffer, position);
+    }
+
+    mutable std::size_t maxCapacity = 0;
+};
+
+class BufferSerializer : public Opm::Serializer<CapacityPacker>
+{
+public:
+    explicit BufferSerializer(const CapacityPacker& packer)
+        : Opm::Serializer<CapacityPacker>(packer)
+    {}
+
+    const std::vector<char>& buffer() const
+    {
+        return m_buffer;
+    }
+
+    using Opm::Serializer<CapacityPacker>::maxChunkSize;
+};
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(PackedBufferCapacity)
+{
+    CapacityPacker packer;
+    BufferSerializer ser(packer);
+
+    // Many small items and a large one, spanning several chunks.
+    const auto names = std::vector<std::string>(200'000, "NAME");
+    const auto values = std::vector<double>(1'000'000, 2.5);
+    ser.pack(names, values);
+
+    const auto size = 2*sizeof(std::size_t)
+        + names.size()*(sizeof(std::size_t) + 4)
+        + values.size()*sizeof(double);
+    BOOST_CHECK_EQUAL(ser.position(), size);
+    BOOST_CHECK_EQUAL(ser.buffer().size(), size);
+    BOOST_CHECK_EQUAL(ser.buffer().capacity(), size);
+
+    // No chunk is larger than the largest item or the chunk size.
+    BOOST_CHECK_LE(packer.maxCapacity, std::max(values.size()*sizeof(double),
+                                                BufferSerializer::maxChunkSize));
+
+    auto outNames = std::vector<std::string>{};
+    auto outValues = std::vector<double>{};
+    ser.unpack(outNames, outValues);
+    BOOST_CHECK_EQUAL(ser.position(), size);
+    BOOST_CHECK(outNames == names);
+    BOOST_CHECK(outValues == values);
+
+    // The buffer shrinks with the packed object.
+    ser.pack(std::string("small"));
+    BOOST_CHECK_EQUAL(ser.position(), sizeof(std::size_t) + 5);
+    BOOST_CHECK_EQUAL(ser.buffer().capacity(), ser.position());
+}
+
+namespace {
+
+struct Table
+{
+    std::vector<double> values{};
+
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(values);
+    }
+
+    bool operator==(const Table& that) const
+    {
+        return this->values == that.values;
+    }
+};
+
+struct SharedTables
+{
+    std::vector<std::shared_ptr<Table>> tables{};
+    std::vector<std::shared_ptr<std::vector<double>>> columns{};
+    std::shared_ptr<std::string> name{};
+
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(tables);
+        serializer(columns);
+        serializer(name);
+    }
+};
+
+SharedTables makeSharedTables()
+{
+    auto data = SharedTables{};
+    data.tables.push_back(std::make_shared<Table>(Table{std::vector<double>(1000, 1.0)}));
+    data.tables.push_back(std::make_shared<Table>(Table{std::vector<double>(1000, 2.0)}));
+    data.tables.push_back(std::make_shared<Table>(Table{std::vector<double>(1000, 1.0)}));
+    data.tables.push_back(data.tables[1]);
+    data.columns.push_back(std::make_shared<std::vector<double>>(10, 3.0));
+    data.columns.push_back(std::make_shared<std::vector<double>>(10, 3.0));
+    data.name = std::make_shared<std::string>("TABLES");
+    return data;
+}
+
+// Two types with the same packed size, but members in different order.
+struct IntFirst
+{
+    int a{};
+    double b{};
+
+    static IntFirst serializationTestObject()
+    {
+        return IntFirst{1, 2.0};
+    }
+
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(a);
+        serializer(b);
+    }
+};
+
+struct DoubleFirst
+{
+    double b{};
+    int a{};
+
+    static DoubleFirst serializationTestObject()
+    {
+        return DoubleFirst{2.0, 1};
+    }
+
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(b);
+        serializer(a);
+    }
+};
+
+std::string fileContents(const std::string& filename)
+{
+    std::ifstream is(filename, std::ios::binary);
+    return { std::istreambuf_iterator<char>{is}, std::istreambuf_iterator<char>{} };
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(SerializedImageRoundTrip)
+{
+    const auto dir = std::filesystem::temp_directory_path() / "opm_serialized_image_test";
+    std::filesystem::create_directories(dir);
+    const auto input = (dir / "CASE.DATA").string();
+    const auto image = (dir / "CASE.OPMIMG").string();
+
+    {
+        std::ofstream os(input);
+        os << "RUNSPEC\n";
+    }
+
+    const auto in = makeSharedTables();
+    const auto count = 17;
+    Opm::SerializedImage::write(image, { input }, in, count);
+
+    {
+        auto out = SharedTables{};
+        auto outCount = 0;
+        BOOST_REQUIRE(Opm::SerializedImage::read(image, out, outCount));
+        BOOST_CHECK_EQUAL(outCount, count);
+        BOOST_REQUIRE_EQUAL(out.tables.size(), in.tables.size());
+        BOOST_CHECK(*out.tables[1] == *in.tables[1]);
+        BOOST_CHECK(out.tables[1] == out.tables[3]);
+    }
+
+    // Image is rejected once the input file changes.
+    {
+        std::ofstream os(input, std::ios::app);
+        os << "GRID\n";
+    }
+    {
+        auto out = SharedTables{};
+        auto outCount = 0;
+        BOOST_CHECK(!Opm::SerializedImage::read(image, out, outCount));
+        BOOST_CHECK(out.tables.empty());
+        BOOST_CHECK_EQUAL(outCount, 0);
+    }
+
+    // Truncated image is rejected.
+    Opm::SerializedImage::write(image, { input }, in, count);
+    std::filesystem::resize_file(image, std::filesystem::file_size(image) - 1);
+    {
+        auto out = SharedTables{};
+        auto outCount = 0;
+        BOOST_CHECK(!Opm::SerializedImage::read(image, out, outCount));
+        BOOST_CHECK(!Opm::SerializedImage::read(image + ".missing", out, outCount));
+    }
+
+    // Image is rejected if read with a different layout, and the objects
+    // are left untouched.
+    Opm::SerializedImage::write(image, { input }, in, count);
+    {
+        auto out = makeSharedTables();
+        out.name = std::make_shared<std::string>("UNTOUCHED");
+        auto outCount = 5.0;
+        BOOST_CHECK(!Opm::SerializedImage::read(image, out, outCount));
+        BOOST_CHECK_EQUAL(*out.name, "UNTOUCHED");
+        BOOST_CHECK_EQUAL(outCount, 5.0);
+
+        auto outTables = SharedTables{};
+        BOOST_CHECK(!Opm::SerializedImage::read(image, outTables));
+        BOOST_CHECK(outTables.tables.empty());
+    }
+
+    // Types of the same packed size, but a different layout, are told
+    // apart by the packed bytes of their sample objects.
+    Opm::SerializedImage::write(image, { input }, IntFirst{3, 4.0});
+    {
+        auto out = DoubleFirst{};
+        BOOST_CHECK(!Opm::SerializedImage::read(image, out));
+
+        auto same = IntFirst{};
+        BOOST_CHECK(Opm::SerializedImage::read(image, same));
+        BOOST_CHECK_EQUAL(same.a, 3);
+    }
+
+    // Shared pointers are packed by order of appearance, not by address,
+    // so equal objects give identical images.
+    {
+        const auto other = (dir / "OTHER.OPMIMG").string();
+        Opm::SerializedImage::write(image, { input }, makeSharedTables(), count);
+        Opm::SerializedImage::write(other, { input }, makeSharedTables(), count);
+        BOOST_CHECK(fileContents(image) == fileContents(other));
+    }
+
+    std::filesystem::remove_all(dir);
+}
+
+BOOST_AUTO_TEST_CASE(SerializedImageSchedule_WELPI)
+{
+    const auto deck = Opm::Parser{}.parseString(R"(RUNSPEC
+START
+7 OCT 2020 /
+
+DIMENS
+  10 10 3 /
+
+GRID
+DXV
+  10*100.0 /
+DYV
+  10*100.0 /
+DZV
+  3*10.0 /
+
+DEPTHZ
+  121*2000.0 /
+
+PERMX
+  300*100.0 /
+PERMY
+  300*100.0 /
+PERMZ
+  300*10.0 /
+PORO
+  300*0.3 /
+
+SCHEDULE
+WELSPECS -- 0
+  'P' 'G' 10 10 2005 'LIQ' /
+/
+COMPDAT
+  'P' 0 0 1 3 OPEN 1 100 /
+/
+
+TSTEP -- 1
+  10
+/
+
+WELPI -- 1
+  'P'  200.0 /
+/
+
+TSTEP -- 2
+  10
+/
+
+COMPDAT -- 2
+  'P' 0 0 2 2 OPEN 1 50 /
+/
+
+TSTEP -- 3
+  10
+/
+
+END
+)");
+
+    const auto dir = std::filesystem::temp_directory_path() / "opm_serialized_image_welpi_test";
+    std::filesystem::create_directories(dir);
+    const auto input = (dir / "CASE.DATA").string();
+    const auto image = (dir / "CASE.OPMIMG").string();
+
+    {
+        std::ofstream os(input);
+        os << "SCHEDULE\n";
+    }
+
+    const auto es = Opm::EclipseState{ deck };
+    auto sched = Opm::Schedule{ deck, es };
+    Opm::SerializedImage::write(image, { input }, sched);
+
+    auto loaded = Opm::Schedule{};
+    BOOST_REQUIRE(Opm::SerializedImage::read(image, loaded));
+    BOOST_REQUIRE_EQUAL(loaded.size(), sched.size());
+
+    auto getConnections = [](const Opm::Schedule& schedule, const std::size_t report_step)
+    {
+        return schedule.getWell("P", report_step).getConnections();
+    };
+
+    const auto initial = getConnections(loaded, 0);
+
+    // WELPI scaling at report step 1 applies to report steps 1 and later,
+    // both in the loaded and in the original schedule.
+    const auto scalingFactor = 2.0;
+    sched.applyWellProdIndexScaling("P", 1, scalingFactor);
+    loaded.applyWellProdIndexScaling("P", 1, scalingFactor);
+
+    BOOST_CHECK(getConnections(loaded, 0) == initial);
+    for (std::size_t report_step = 0; report_step < sched.size(); ++report_step) {
+        BOOST_CHECK_MESSAGE(getConnections(loaded, report_step) == getConnections(sched, report_step),
+                            "Connections of loaded schedule must match at report step " << report_step);
+    }
+
+    BOOST_REQUIRE_EQUAL(getConnections(loaded, 1).size(), initial.size());
+    for (std::size_t i = 0; i < initial.size(); ++i) {
+        BOOST_CHECK_CLOSE(getConnections(loaded, 1)[i].CF(), scalingFactor * initial[i].CF(), 1.0e-10);
+    }
+
+    std::filesystem::remove_all(dir);
+}
+
 namespace {
 
 bool init_unit_test_func()
@@ -6663,6 +6663,43 @@ BOOST_AUTO_TEST_CASE(SummaryState_TOTAL) {
     BOOST_CHECK_EQUAL(st.get_elapsed(), 200);
 }
 
+BOOST_AUTO_TEST_CASE(update_well_group_var) {
+    SummaryState st(TimeService::now(), 0.0);
+
+    st.update_well_var("OP1", "WOPR", 10);
+    st.update_well_var("OP2", "WOPR", 20);
+    st.update_group_var("G1", "GOPR", 30);
+    BOOST_CHECK(st.wells() == std::vector<std::string>({"OP1", "OP2"}));
+    BOOST_CHECK(st.groups() == std::vector<std::string>({"G1"}));
+
+    // Existing wells and groups
+    st.update_well_var("OP1", "WOPR", 11);
+    st.update_well_var("OP1", "WOPT", 5);
+    st.update_well_var("OP1", "WOPT", 5);
+    st.update_group_var("G1", "GOPR", 31);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPR"), 11);
+    BOOST_CHECK_EQUAL(st.get("WOPR:OP1"), 11);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP1", "WOPT"), 10);
+    BOOST_CHECK_EQUAL(st.get("WOPT:OP1"), 10);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP2", "WOPR"), 20);
+    BOOST_CHECK_EQUAL(st.get_group_var("G1", "GOPR"), 31);
+    BOOST_CHECK_EQUAL(st.get("GOPR:G1"), 31);
+    BOOST_CHECK(st.wells() == std::vector<std::string>({"OP1", "OP2"}));
+    BOOST_CHECK(st.groups() == std::vector<std::string>({"G1"}));
+
+    // New wells and groups, also for already known variables
+    st.update_well_var("A_WELL_WITH_A_LONG_NAME", "WOPR", 40);
+    st.update_group_var("G0", "GOPR", 50);
+    st.update_group_var("G2", "GWPR", 60);
+    BOOST_CHECK_EQUAL(st.get_well_var("A_WELL_WITH_A_LONG_NAME", "WOPR"), 40);
+    BOOST_CHECK_EQUAL(st.get("WOPR:A_WELL_WITH_A_LONG_NAME"), 40);
+    BOOST_CHECK_EQUAL(st.get_group_var("G0", "GOPR"), 50);
+    BOOST_CHECK_EQUAL(st.get_group_var("G2", "GWPR"), 60);
+    BOOST_CHECK(st.wells() == std::vector<std::string>({"A_WELL_WITH_A_LONG_NAME", "OP1", "OP2"}));
+    BOOST_CHECK(st.groups() == std::vector<std::string>({"G0", "G1", "G2"}));
+    BOOST_CHECK_EQUAL(st.num_wells(), 3U);
+}
+
 BOOST_AUTO_TEST_CASE(append_summary_state) {
     auto now = TimeService::now();
     SummaryState st1(now, 0.0);